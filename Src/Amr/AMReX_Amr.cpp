@@ -7,6 +7,7 @@
 #include <iomanip>
 #include <limits>
 #include <cmath>
+#include <thread>
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -36,6 +37,11 @@
 #include <AMReX_PlotFileUtil.H>
 #include <AMReX_Print.H>
 
+#ifdef AMREX_USE_EB
+#include <AMReX_EB2.H>
+#include <AMReX_EBAmrUtil.H>
+#endif
+
 #ifdef AMREX_USE_FBOXLIB_MG
 #include <mg_cpp_f.h>
 #endif
@@ -101,6 +107,16 @@ namespace
     bool initialized = false;
 }
 
+struct Amr::AsyncRegrid
+{
+    int lbase;
+    int level_step;  // level_steps[lbase] when the cells were tagged
+    AmrMesh::DeferredClustering dc;
+    std::thread worker;
+
+    ~AsyncRegrid () { if (worker.joinable()) worker.join(); }
+};
+
 //Tan Nov 24, 2017 : I removed this anonymous namespace so I could access the inner variables from other source files 
 //namespace   
 //{
@@ -111,6 +127,7 @@ namespace
     int  mffile_nstreams;
     int  probinit_natonce;
     bool plot_files_output;
+    int  group_derive_plot_vars;
     int  checkpoint_nfiles;
     int  regrid_on_restart;
     int  use_efficient_regrid;
@@ -146,6 +163,7 @@ Amr::Initialize ()
     mffile_nstreams          = 1;
     probinit_natonce         = 512;
     plot_files_output        = true;
+    group_derive_plot_vars   = 0;
     checkpoint_nfiles        = 64;
     regrid_on_restart        = 0;
     use_efficient_regrid     = 0;
@@ -181,6 +199,8 @@ Amr::Finalize ()
 
 bool Amr::Plot_Files_Output () { return plot_files_output; }
 
+bool Amr::groupDerivePlotVars () { return group_derive_plot_vars; }
+
 std::ostream&
 Amr::DataLog (int i)
 {
@@ -519,6 +539,12 @@ Amr::InitAmr ()
 
     loadbalance_max_fac = 1.5;
     pp.query("loadbalance_max_fac", loadbalance_max_fac);
+
+    fillpatch_crse_cache = 0;
+    pp.query("fillpatch_crse_cache", fillpatch_crse_cache);
+
+    async_regrid = 0;
+    pp.query("async_regrid", async_regrid);
 }
 
 int
@@ -746,6 +772,8 @@ Amr::deleteDeriveSmallPlotVar (const std::string& name)
 
 Amr::~Amr ()
 {
+    async_regrid_plan.reset();
+
     levelbld->variableCleanUp();
 
     Amr::Finalize();
@@ -1971,7 +1999,10 @@ Amr::timeStep (int  level,
         {
             const int old_finest = finest_level;
 
-            if (okToRegrid(i))
+            const bool ok_to_regrid = okToRegrid(i);
+            const bool async_pending = asyncRegridPending(i);
+
+            if (ok_to_regrid || async_pending)
             {
 #ifdef USE_PERILLA
 		//ask the communication thread to stop so that I can update the metadata
@@ -1989,12 +2020,27 @@ Amr::timeStep (int  level,
 		    }
 		}
 #endif
-                regrid(i,time);
+                //
+                // A regrid started on an earlier step is finished first.
+                // Then, with amr.async_regrid, a new one may be started,
+                // which leaves the grids as they are for now.
+                //
+                bool regridded = false;
+                if (async_pending)
+                {
+                    regrid(i,time);
+                    regridded = true;
+                }
+                if (ok_to_regrid && !startAsyncRegrid(i,time))
+                {
+                    regrid(i,time);
+                    regridded = true;
+                }
 
                 //
                 // Compute new dt after regrid if at level 0 and compute_new_dt_on_regrid.
                 //
-                if ( compute_new_dt_on_regrid && (i == 0) )
+                if ( regridded && compute_new_dt_on_regrid && (i == 0) )
                 {
                     int post_regrid_flag = 1;
                     amr_level[0]->computeNewDt(finest_level,
@@ -2007,8 +2053,10 @@ Amr::timeStep (int  level,
 					       post_regrid_flag);
                 }
 
-                for (int k(i); k <= finest_level; ++k) {
-                    level_count[k] = 0;
+                if (ok_to_regrid) {
+                    for (int k(i); k <= finest_level; ++k) {
+                        level_count[k] = 0;
+                    }
 		}
 
                 if (old_finest < finest_level)
@@ -2136,9 +2184,19 @@ Amr::timeStep (int  level,
         {
             const int ncycle = n_cycle[lev_fine];
 
+            // The data at this level do not change during the fine
+            // steps, so the fine level can keep what it copies from them.
+            if (fillpatch_crse_cache) {
+                amr_level[lev_fine]->keepFillPatchCrseData(true);
+            }
+
             BL_COMM_PROFILE_NAMETAG("Amr::timeStep timeStep subcycle");
             for (int i = 1; i <= ncycle; i++)
                 timeStep(lev_fine,time+(i-1)*dt_level[lev_fine],i,ncycle,stop_time);
+
+            if (fillpatch_crse_cache && lev_fine <= finest_level) {
+                amr_level[lev_fine]->keepFillPatchCrseData(false);
+            }
         }
         else
         {
@@ -2636,7 +2694,7 @@ Amr::defBaseLevel (Real              strt_time,
     }
 
     this->SetBoxArray(0, lev0);
-    this->SetDistributionMap(0, DistributionMapping(lev0));
+    this->SetDistributionMap(0, makeDistributionMap(0, lev0));
 
     //
     // Now build level 0 grids.
@@ -2667,7 +2725,19 @@ Amr::regrid (int  lbase,
     Vector<BoxArray> new_grid_places(max_level+1);
     Vector<DistributionMapping> new_dmap(max_level+1);
 
-    grid_places(lbase,time,new_finest, new_grid_places);
+    if (async_regrid_plan && !initial && async_regrid_plan->lbase == lbase)
+    {
+        async_grid_places(new_finest, new_grid_places);
+    }
+    else
+    {
+        //
+        // A regrid at a coarser level makes the pending one useless.
+        //
+        async_regrid_plan.reset();
+
+        grid_places(lbase,time,new_finest, new_grid_places);
+    }
 
     bool regrid_level_zero = (!initial) && (lbase == 0)
         && ( loadbalance_with_workestimates || (new_grid_places[0] != amr_level[0]->boxArray()));
@@ -2696,10 +2766,26 @@ Amr::regrid (int  lbase,
 	return;
     }
 
+    //
+    // With incremental regridding, the levels whose grids are unchanged,
+    // and whose coarser levels are unchanged too, are kept as they are.
+    //
+    int rebuild_start = start;
+    if (incremental_regrid && !initial && !loadbalance_with_workestimates)
+    {
+        for (int lev = start, End = std::min(finest_level,new_finest); lev <= End; lev++) {
+            if (new_grid_places[lev] == amr_level[lev]->boxArray()) {
+                rebuild_start = lev+1;
+            } else {
+                break;
+            }
+        }
+    }
+
     //
     // Reclaim old-time grid space for all remain levels > lbase.
     //
-    for(int lev = start; lev <= finest_level; ++lev) {
+    for(int lev = rebuild_start; lev <= finest_level; ++lev) {
 	amr_level[lev]->removeOldData();
     }
     //
@@ -2722,7 +2808,7 @@ Amr::regrid (int  lbase,
     //
     // Define the new grids from level start up to new_finest.
     //
-    for(int lev = start; lev <= new_finest; ++lev) {
+    for(int lev = rebuild_start; lev <= new_finest; ++lev) {
         //
         // Construct skeleton of new level.
         //
@@ -2731,7 +2817,13 @@ Amr::regrid (int  lbase,
             new_dmap[lev] = makeLoadBalanceDistributionMap(lev, time, new_grid_places[lev]);
         }
         else if (new_dmap[lev].empty()) {
-	    new_dmap[lev].define(new_grid_places[lev]);
+            if (incremental_regrid && !initial && amr_level[lev]) {
+                new_dmap[lev] = DistributionMapping::makeIncremental(new_grid_places[lev],
+                                                                     amr_level[lev]->boxArray(),
+                                                                     amr_level[lev]->DistributionMap());
+            } else {
+                new_dmap[lev] = makeDistributionMap(lev, new_grid_places[lev]);
+            }
 	}
 
         AmrLevel* a = (*levelbld)(*this,lev,Geom(lev),new_grid_places[lev],
@@ -2871,6 +2963,17 @@ Amr::makeLoadBalanceDistributionMap (int lev, Real time, const BoxArray& ba) con
     return newdm;
 }
 
+DistributionMapping
+Amr::makeDistributionMap (int lev, const BoxArray& ba) const
+{
+#ifdef AMREX_USE_EB
+    if (EB2::load_balance && !EB2::IndexSpace::empty()) {
+        return EBDistributionMapping(ba, Geom(lev));
+    }
+#endif
+    return DistributionMapping(ba);
+}
+
 void
 Amr::LoadBalanceLevel0 (Real time)
 {
@@ -2920,7 +3023,7 @@ Amr::regrid_level_0_on_restart()
 	//
 	// Construct skeleton of new level.
 	//
-	DistributionMapping dm(lev0);
+	DistributionMapping dm = makeDistributionMap(0, lev0);
 	AmrLevel* a = (*levelbld)(*this,0,Geom(0),lev0,dm,cumtime);
 	
 	a->init(*amr_level[0]);
@@ -2996,6 +3099,79 @@ Amr::printGridInfo (std::ostream& os,
 }
 
 
+bool
+Amr::startAsyncRegrid (int lbase, Real time)
+{
+#if defined(BL_PROFILING) || defined(BL_TINY_PROFILING) || defined(BL_MEM_PROFILING) || defined(USE_PERILLA)
+    //
+    // The profilers are not thread safe.
+    //
+    return false;
+#else
+    //
+    // Only the grids of level lbase+1 are made from tags, so that the
+    // clustering is the last step that needs the tags.
+    //
+    if (!async_regrid || local_clustering || lbase != std::min(finest_level, max_level-1)
+        || !initial_grids_file.empty() || !regrid_grids_file.empty())
+    {
+        return false;
+    }
+
+    BL_PROFILE("Amr::startAsyncRegrid()");
+
+    async_regrid_plan.reset(new AsyncRegrid);
+    AsyncRegrid& plan = *async_regrid_plan;
+    plan.lbase = lbase;
+    plan.level_step = level_steps[lbase];
+
+    MakeNewGridTags(lbase, time, plan.dc);
+
+    AmrMesh::DeferredClustering* dc = &plan.dc;
+    plan.worker = std::thread([this,dc] () { ClusterDeferredTags(*dc); });
+
+    if (verbose > 0) {
+        amrex::Print() << "Started asynchronous regrid at level lbase = " << lbase << "\n";
+    }
+
+    return true;
+#endif
+}
+
+bool
+Amr::asyncRegridPending (int lbase) const
+{
+    return async_regrid_plan && async_regrid_plan->lbase == lbase
+        && async_regrid_plan->level_step != level_steps[lbase];
+}
+
+void
+Amr::async_grid_places (int& new_finest, Vector<BoxArray>& new_grids)
+{
+    BL_PROFILE("Amr::async_grid_places()");
+
+    const Real strttime = amrex::second();
+
+    AsyncRegrid& plan = *async_regrid_plan;
+    plan.worker.join();
+
+    if (plan.lbase == 0)
+    {
+        new_grids[0] = MakeBaseGrids();
+    }
+
+    FinishNewGrids(plan.dc, new_finest, new_grids);
+
+    async_regrid_plan.reset();
+
+    if (verbose > 0)
+    {
+        Real stoptime = amrex::second() - strttime;
+        ParallelDescriptor::ReduceRealMax(stoptime,ParallelDescriptor::IOProcessorNumber());
+        amrex::Print() << "async_grid_places() time: " << stoptime << " new finest: " << new_finest << '\n';
+    }
+}
+
 void
 Amr::grid_places (int              lbase,
                   Real             time,
@@ -3132,7 +3308,7 @@ Amr::bldFineLevels (Real strt_time)
         //
         finest_level = new_finest;
 
-	DistributionMapping new_dm {new_grids[new_finest]};
+	DistributionMapping new_dm = makeDistributionMap(new_finest, new_grids[new_finest]);
 
         AmrLevel* level = (*levelbld)(*this,
                                       new_finest,
@@ -3290,6 +3466,7 @@ Amr::initPltAndChk ()
 
     pp.query("checkpoint_files_output", checkpoint_files_output);
     pp.query("plot_files_output", plot_files_output);
+    pp.query("group_derive_plot_vars", group_derive_plot_vars);
 
     pp.query("plot_nfiles", plot_nfiles);
     pp.query("checkpoint_nfiles", checkpoint_nfiles);
@@ -4,6 +4,7 @@
 #include <unistd.h>
 #include <memory>
 #include <limits>
+#include <map>
 
 #include <AMReX_AmrLevel.H>
 #include <AMReX_Derive.H>
@@ -40,6 +41,53 @@ EBSupport AmrLevel::m_eb_support_level = EBSupport::volume;
 DescriptorList AmrLevel::desc_lst;
 DeriveList     AmrLevel::derive_lst;
 
+namespace
+{
+    //
+    // Calls the Fortran derive function of rec on box bx of dfab.
+    //
+    void
+    derive_fort (const DeriveRec* rec, FArrayBox& dfab, int dcomp, const Box& bx,
+                 FArrayBox& sfab, const Box& domain, const Geometry& geom,
+                 Real time, Real dt, int level, int idx)
+    {
+        Real*       ddat    = dfab.dataPtr(dcomp);
+        const int*  dlo     = dfab.loVect();
+        const int*  dhi     = dfab.hiVect();
+        const int*  lo      = bx.loVect();
+        const int*  hi      = bx.hiVect();
+        int         n_der   = rec->numDerive();
+        Real*       cdat    = sfab.dataPtr();
+        const int*  clo     = sfab.loVect();
+        const int*  chi     = sfab.hiVect();
+        int         n_state = rec->numState();
+        const int*  dom_lo  = domain.loVect();
+        const int*  dom_hi  = domain.hiVect();
+        const Real* dx      = geom.CellSize();
+        const int*  bcr     = rec->getBC();
+        const RealBox& temp = RealBox(bx,geom.CellSize(),geom.ProbLo());
+        const Real* xlo     = temp.lo();
+
+        if (rec->derFunc() != static_cast<DeriveFunc>(0)){
+            rec->derFunc()(ddat,AMREX_ARLIM(dlo),AMREX_ARLIM(dhi),&n_der,
+                           cdat,AMREX_ARLIM(clo),AMREX_ARLIM(chi),&n_state,
+                           lo,hi,dom_lo,dom_hi,dx,xlo,&time,&dt,bcr,
+                           &level,&idx);
+        } else if (rec->derFunc3D() != static_cast<DeriveFunc3D>(0)){
+            rec->derFunc3D()(ddat,AMREX_ARLIM_3D(dlo),AMREX_ARLIM_3D(dhi),&n_der,
+                             cdat,AMREX_ARLIM_3D(clo),AMREX_ARLIM_3D(chi),&n_state,
+                             AMREX_ARLIM_3D(lo),AMREX_ARLIM_3D(hi),
+                             AMREX_ARLIM_3D(dom_lo),AMREX_ARLIM_3D(dom_hi),
+                             AMREX_ZFILL(dx),AMREX_ZFILL(xlo),
+                             &time,&dt,
+                             AMREX_BCREC_3D(bcr),
+                             &level,&idx);
+        } else {
+            amrex::Error("AmeLevel::derive: no function available");
+        }
+    }
+}
+
 void
 AmrLevel::postCoarseTimeStep (Real time)
 {
@@ -313,11 +361,19 @@ AmrLevel::writePlotFile (const std::string& dir,
     // derived
     if (derive_names.size() > 0)
     {
-	for (auto const& dname : derive_names)
-	{
-            derive(dname, cur_time, plotMF, cnt);
-	    cnt++;
-	}
+        if (parent->groupDerivePlotVars())
+        {
+            deriveGrouped(derive_names, cur_time, plotMF, cnt);
+            cnt += derive_names.size();
+        }
+        else
+        {
+            for (auto const& dname : derive_names)
+            {
+                derive(dname, cur_time, plotMF, cnt);
+                cnt++;
+            }
+        }
     }
 
     //
@@ -527,6 +583,16 @@ AmrLevel::~AmrLevel ()
     parent = 0;
 }
 
+void
+AmrLevel::keepFillPatchCrseData (bool flag)
+{
+    if (flag) {
+        if (!fp_crse_cache) fp_crse_cache.reset(new FillPatchCrseCache());
+    } else {
+        fp_crse_cache.reset();
+    }
+}
+
 void
 AmrLevel::allocOldData ()
 {
@@ -1087,16 +1153,33 @@ FillPatchIterator::FillFromTwoLevels (Real time, int idx, int scomp, int dcomp,
 
     const StateDescriptor& desc = AmrLevel::desc_lst[idx];
 
-    amrex::FillPatchTwoLevels(m_fabs, time, 
-                              smf_crse, stime_crse, 
-                              smf_fine, stime_fine,
-                              scomp, dcomp, ncomp, 
-                              geom_crse, geom_fine,
-                              physbcf_crse, scomp,
-                              physbcf_fine, scomp,
-                              crse_level.fineRatio(), 
-                              desc.interp(scomp),
-                              desc.getBCs(),scomp);
+    if (fine_level.fp_crse_cache)
+    {
+        amrex::FillPatchTwoLevels_nowait(m_fabs, time,
+                                         smf_crse, stime_crse,
+                                         smf_fine, stime_fine,
+                                         scomp, dcomp, ncomp,
+                                         geom_crse, geom_fine,
+                                         physbcf_crse, scomp,
+                                         physbcf_fine, scomp,
+                                         crse_level.fineRatio(),
+                                         desc.interp(scomp),
+                                         desc.getBCs(),scomp,
+                                         fine_level.fp_crse_cache.get()).wait();
+    }
+    else
+    {
+        amrex::FillPatchTwoLevels(m_fabs, time, 
+                                  smf_crse, stime_crse, 
+                                  smf_fine, stime_fine,
+                                  scomp, dcomp, ncomp, 
+                                  geom_crse, geom_fine,
+                                  physbcf_crse, scomp,
+                                  physbcf_fine, scomp,
+                                  crse_level.fineRatio(), 
+                                  desc.interp(scomp),
+                                  desc.getBCs(),scomp);
+    }
 }
 
 static
@@ -1796,88 +1879,23 @@ AmrLevel::derive (const std::string& name, Real time, MultiFab& mf, int dcomp)
         }
         else
         {
+            const Box& domain = state[index].getDomain();
+            const Real dt = parent->dtLevel(level);
 #if defined(AMREX_CRSEGRNDOMP) || (!defined(AMREX_XSDK) && defined(CRSEGRNDOMP))
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
-        for (MFIter mfi(mf,true); mfi.isValid(); ++mfi)
-        {
-            int         idx     = mfi.index();
-            Real*       ddat    = mf[mfi].dataPtr(dcomp);
-            const int*  dlo     = mf[mfi].loVect();
-            const int*  dhi     = mf[mfi].hiVect();
-	    const Box&  gtbx    = mfi.growntilebox();
-	    const int*  lo      = gtbx.loVect();
-	    const int*  hi      = gtbx.hiVect();
-            int         n_der   = rec->numDerive();
-            Real*       cdat    = srcMF[mfi].dataPtr();
-            const int*  clo     = srcMF[mfi].loVect();
-            const int*  chi     = srcMF[mfi].hiVect();
-            int         n_state = rec->numState();
-            const int*  dom_lo  = state[index].getDomain().loVect();
-            const int*  dom_hi  = state[index].getDomain().hiVect();
-            const Real* dx      = geom.CellSize();
-            const int*  bcr     = rec->getBC();
-            const RealBox& temp = RealBox(gtbx,geom.CellSize(),geom.ProbLo());
-            const Real* xlo     = temp.lo();
-            Real        dt      = parent->dtLevel(level);
-
-	    if (rec->derFunc() != static_cast<DeriveFunc>(0)){
-		rec->derFunc()(ddat,AMREX_ARLIM(dlo),AMREX_ARLIM(dhi),&n_der,
-			       cdat,AMREX_ARLIM(clo),AMREX_ARLIM(chi),&n_state,
-			       lo,hi,dom_lo,dom_hi,dx,xlo,&time,&dt,bcr,
-			       &level,&idx);
-	    } else if (rec->derFunc3D() != static_cast<DeriveFunc3D>(0)){
-		rec->derFunc3D()(ddat,AMREX_ARLIM_3D(dlo),AMREX_ARLIM_3D(dhi),&n_der,
-				 cdat,AMREX_ARLIM_3D(clo),AMREX_ARLIM_3D(chi),&n_state,
-				 AMREX_ARLIM_3D(lo),AMREX_ARLIM_3D(hi),
-				 AMREX_ARLIM_3D(dom_lo),AMREX_ARLIM_3D(dom_hi),
-				 AMREX_ZFILL(dx),AMREX_ZFILL(xlo),
-				 &time,&dt,
-				 AMREX_BCREC_3D(bcr),
-				 &level,&idx);
-	    } else {
-		amrex::Error("AmeLevel::derive: no function available");
-	    }
-        }
+            for (MFIter mfi(mf,true); mfi.isValid(); ++mfi)
+            {
+                derive_fort(rec, mf[mfi], dcomp, mfi.growntilebox(), srcMF[mfi],
+                            domain, geom, time, dt, level, mfi.index());
+            }
 #else
-        for (MFIter mfi(srcMF); mfi.isValid(); ++mfi)
-        {
-            int         idx     = mfi.index();
-            Real*       ddat    = mf[mfi].dataPtr(dcomp);
-            const int*  dlo     = mf[mfi].loVect();
-            const int*  dhi     = mf[mfi].hiVect();
-            int         n_der   = rec->numDerive();
-            Real*       cdat    = srcMF[mfi].dataPtr();
-            const int*  clo     = srcMF[mfi].loVect();
-            const int*  chi     = srcMF[mfi].hiVect();
-            int         n_state = rec->numState();
-            const int*  dom_lo  = state[index].getDomain().loVect();
-            const int*  dom_hi  = state[index].getDomain().hiVect();
-            const Real* dx      = geom.CellSize();
-            const int*  bcr     = rec->getBC();
-            const RealBox& temp = RealBox(mf[mfi].box(),geom.CellSize(),geom.ProbLo());
-            const Real* xlo     = temp.lo();
-            Real        dt      = parent->dtLevel(level);
-
-	    if (rec->derFunc() != static_cast<DeriveFunc>(0)){
-		rec->derFunc()(ddat,AMREX_ARLIM(dlo),AMREX_ARLIM(dhi),&n_der,
-			       cdat,AMREX_ARLIM(clo),AMREX_ARLIM(chi),&n_state,
-			       dlo,dhi,dom_lo,dom_hi,dx,xlo,&time,&dt,bcr,
-			       &level,&idx);
-	    } else if (rec->derFunc3D() != static_cast<DeriveFunc3D>(0)){
-		rec->derFunc3D()(ddat,AMREX_ARLIM_3D(dlo),AMREX_ARLIM_3D(dhi),&n_der,
-				 cdat,AMREX_ARLIM_3D(clo),AMREX_ARLIM_3D(chi),&n_state,
-				 AMREX_ARLIM_3D(dlo),AMREX_ARLIM_3D(dhi),
-				 AMREX_ARLIM_3D(dom_lo),AMREX_ARLIM_3D(dom_hi),
-				 AMREX_ZFILL(dx),AMREX_ZFILL(xlo),
-				 &time,&dt,
-				 AMREX_BCREC_3D(bcr),
-				 &level,&idx);
-	    } else {
-		amrex::Error("AmeLevel::derive: no function available");
-	    }
-        }
+            for (MFIter mfi(srcMF); mfi.isValid(); ++mfi)
+            {
+                derive_fort(rec, mf[mfi], dcomp, mf[mfi].box(), srcMF[mfi],
+                            domain, geom, time, dt, level, mfi.index());
+            }
 #endif
         }
     }
@@ -1892,6 +1910,149 @@ AmrLevel::derive (const std::string& name, Real time, MultiFab& mf, int dcomp)
     }
 }
 
+void
+AmrLevel::deriveGrouped (const std::vector<std::string>& names, Real time,
+                         MultiFab& mf, int dcomp)
+{
+    BL_PROFILE("AmrLevel::deriveGrouped()");
+
+    BL_ASSERT(dcomp + static_cast<int>(names.size()) <= mf.nComp());
+
+    const int ngrow = mf.nGrow();
+    //
+    // The derived quantities that need the same source data share one
+    // source MultiFab.  The key of a group is the number of ghost cells and
+    // of components of the source, followed by the state index, the first
+    // component and the number of components of each range.
+    //
+    struct DeriveItem
+    {
+        const DeriveRec* rec;
+        int dcomp;
+        int ncomp;   // of the last range, as passed by derive()
+        int index;   // of the last range
+        int group;
+    };
+
+    std::map<std::vector<int>,int> group_map;
+    std::vector<std::vector<int> > group_keys;
+    std::vector<DeriveItem> fab_items, fort_items;
+
+    for (int i = 0, N = names.size(); i < N; ++i)
+    {
+        const std::string& name = names[i];
+        int index, scomp, ncomp;
+        const DeriveRec* rec = derive_lst.get(name);
+
+        if (isStateVariable(name,index,scomp) || rec == nullptr)
+        {
+            derive(name, time, mf, dcomp+i);
+            continue;
+        }
+
+        rec->getRange(0,index,scomp,ncomp);
+
+        int ngrow_src = ngrow;
+        {
+            Box bx0 = state[index].boxArray()[0];
+            Box bx1 = rec->boxMap()(bx0);
+            ngrow_src += bx0.smallEnd(0) - bx1.smallEnd(0);
+        }
+
+        std::vector<int> key{ngrow_src, rec->numState()};
+        for (int k = 0; k < rec->numRange(); ++k)
+        {
+            rec->getRange(k,index,scomp,ncomp);
+            key.push_back(index);
+            key.push_back(scomp);
+            key.push_back(ncomp);
+        }
+
+        auto it = group_map.find(key);
+        if (it == group_map.end())
+        {
+            it = group_map.insert(std::make_pair(key, static_cast<int>(group_keys.size()))).first;
+            group_keys.push_back(key);
+        }
+
+        DeriveItem item{rec, dcomp+i, ncomp, index, it->second};
+        if (rec->derFuncFab() != nullptr) {
+            fab_items.push_back(item);
+        } else {
+            fort_items.push_back(item);
+        }
+    }
+
+    if (group_keys.empty()) return;
+    //
+    // One FillPatch per group.
+    //
+    Vector<std::unique_ptr<MultiFab> > srcMF(group_keys.size());
+    for (int g = 0, N = group_keys.size(); g < N; ++g)
+    {
+        const std::vector<int>& key = group_keys[g];
+        const int ngrow_src = key[0];
+        const BoxArray& srcBA = state[key[2]].boxArray();
+
+        srcMF[g].reset(new MultiFab(srcBA,dmap,key[1],ngrow_src,MFInfo(),*m_factory));
+
+        for (int k = 2, dc = 0, nk = key.size(); k < nk; k += 3)
+        {
+            FillPatch(*this,*srcMF[g],ngrow_src,time,key[k],key[k+1],key[k+2],dc);
+            dc += key[k+2];
+        }
+    }
+    //
+    // One pass over the fabs for all of the derive functions.
+    //
+    if (!fab_items.empty())
+    {
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+        for (MFIter mfi(mf,TilingIfNotGPU()); mfi.isValid(); ++mfi)
+        {
+            const Box& bx = mfi.growntilebox();
+            FArrayBox* derfab = mf.fabPtr(mfi);
+            for (const auto& item : fab_items)
+            {
+                FArrayBox const* datafab = srcMF[item.group]->fabPtr(mfi);
+                item.rec->derFuncFab()(bx, *derfab, item.dcomp, item.ncomp, *datafab,
+                                       geom, time, item.rec->getBC(), level);
+            }
+        }
+    }
+
+    if (!fort_items.empty())
+    {
+        const Real dt = parent->dtLevel(level);
+#if defined(AMREX_CRSEGRNDOMP) || (!defined(AMREX_XSDK) && defined(CRSEGRNDOMP))
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        for (MFIter mfi(mf,true); mfi.isValid(); ++mfi)
+        {
+            const Box& bx = mfi.growntilebox();
+            for (const auto& item : fort_items)
+            {
+                derive_fort(item.rec, mf[mfi], item.dcomp, bx, (*srcMF[item.group])[mfi],
+                            state[item.index].getDomain(), geom, time, dt, level, mfi.index());
+            }
+        }
+#else
+        for (MFIter mfi(mf); mfi.isValid(); ++mfi)
+        {
+            const Box& bx = mf[mfi].box();
+            for (const auto& item : fort_items)
+            {
+                derive_fort(item.rec, mf[mfi], item.dcomp, bx, (*srcMF[item.group])[mfi],
+                            state[item.index].getDomain(), geom, time, dt, level, mfi.index());
+            }
+        }
+#endif
+    }
+}
+
 //! Update the distribution maps in StateData based on the size of the map
 void
 AmrLevel::UpdateDistributionMaps ( DistributionMapping& update_dmap )
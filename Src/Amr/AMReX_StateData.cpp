@@ -1,6 +1,8 @@
 
 #include <iostream>
 #include <algorithm>
+#include <list>
+#include <typeinfo>
 
 #include <unistd.h>
 
@@ -9,6 +11,7 @@
 #include <AMReX_StateDescriptor.H>
 #include <AMReX_ParallelDescriptor.H>
 #include <AMReX_Utility.H>
+#include <AMReX_ParmParse.H>
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -24,6 +27,109 @@ static constexpr int MFOLDDATA = 1;
 Vector<std::string> StateData::fabArrayHeaderNames;
 std::map<std::string, Vector<char> > *StateData::faHeaderMap;
 
+//
+// Static class members.  Set defaults in Initialize()!!!
+//
+bool StateData::copy_on_write = false;
+int  StateData::pool_size     = 0;
+
+namespace
+{
+    bool initialized = false;
+    //
+    // Removed data kept for reuse, the most recent last.
+    //
+    std::list<std::shared_ptr<MultiFab> > the_pool;
+
+    bool isDefaultFactory (const FabFactory<FArrayBox>& factory)
+    {
+        return dynamic_cast<DefaultFabFactory<FArrayBox> const*>(&factory) != nullptr;
+    }
+}
+
+void
+StateData::Initialize ()
+{
+    if (initialized) return;
+
+    copy_on_write = false;
+    pool_size     = 0;
+
+    ParmParse pp("amr");
+    pp.query("state_copy_on_write", copy_on_write);
+    pp.query("state_pool_size", pool_size);
+
+    amrex::ExecOnFinalize(StateData::Finalize);
+
+    initialized = true;
+}
+
+void
+StateData::Finalize ()
+{
+    the_pool.clear();
+    initialized = false;
+}
+
+std::shared_ptr<MultiFab>
+StateData::allocData () const
+{
+    Initialize();
+
+    const int ncomp = desc->nComp();
+    const int ngrow = desc->nExtra();
+
+    if (pool_size > 0 && isDefaultFactory(*m_factory))
+    {
+        for (auto it = the_pool.rbegin(); it != the_pool.rend(); ++it)
+        {
+            const MultiFab& mf = **it;
+            if (mf.nComp() == ncomp && mf.nGrow() == ngrow &&
+                mf.boxArray() == grids && mf.DistributionMap() == dmap)
+            {
+                std::shared_ptr<MultiFab> r = std::move(*it);
+                the_pool.erase(std::next(it).base());
+                if (FArrayBox::get_do_initval()) {
+                    r->setVal(FArrayBox::get_initval(), 0, ncomp, ngrow);
+                }
+                return r;
+            }
+        }
+    }
+
+    return std::make_shared<MultiFab>(grids,dmap,ncomp,ngrow,MFInfo(),*m_factory);
+}
+
+void
+StateData::releaseData (std::shared_ptr<MultiFab>& mf)
+{
+    if (mf && mf.use_count() == 1 && pool_size > 0 && isDefaultFactory(mf->Factory()))
+    {
+        the_pool.push_back(std::move(mf));
+        while (static_cast<int>(the_pool.size()) > pool_size) {
+            the_pool.pop_front();
+        }
+    }
+    mf.reset();
+}
+
+void
+StateData::unshare (std::shared_ptr<MultiFab>& mf) const
+{
+    BL_PROFILE("StateData::unshare()");
+    std::shared_ptr<MultiFab> p = allocData();
+    MultiFab::Copy(*p, *mf, 0, 0, mf->nComp(), mf->nGrow());
+    mf = std::move(p);
+}
+
+bool
+StateData::canShare (const MultiFab& mf) const
+{
+    return mf.nComp() == desc->nComp() && mf.nGrow() == desc->nExtra()
+        && mf.boxArray() == grids && mf.DistributionMap() == dmap
+        && typeid(mf.Factory()) == typeid(*m_factory);
+}
+
 
 StateData::StateData () 
     : desc(nullptr),
@@ -59,6 +165,7 @@ StateData::StateData (StateData&& rhs) noexcept
 void
 StateData::operator= (StateData const& rhs)
 {
+    if (this == &rhs) return;
     m_factory.reset(rhs.m_factory->clone());
     desc = rhs.desc;
     domain = rhs.domain;
@@ -66,13 +173,19 @@ StateData::operator= (StateData const& rhs)
     dmap = rhs.dmap;
     new_time = rhs.new_time;
     old_time = rhs.old_time;
-    new_data.reset(new MultiFab(grids,dmap,desc->nComp(),desc->nExtra(), MFInfo(), *m_factory));
-    MultiFab::Copy(*new_data, *rhs.new_data, 0, 0, desc->nComp(),desc->nExtra());
-    if (rhs.old_data) {
-        old_data.reset(new MultiFab(grids,dmap,desc->nComp(),desc->nExtra(), MFInfo(), *m_factory));
-        MultiFab::Copy(*old_data, *rhs.old_data, 0, 0, desc->nComp(),desc->nExtra());
+    Initialize();
+    releaseData(new_data);
+    releaseData(old_data);
+    if (copy_on_write) {
+        new_data = rhs.new_data;
+        old_data = rhs.old_data;
     } else {
-        old_data.reset();
+        new_data = allocData();
+        MultiFab::Copy(*new_data, *rhs.new_data, 0, 0, desc->nComp(),desc->nExtra());
+        if (rhs.old_data) {
+            old_data = allocData();
+            MultiFab::Copy(*old_data, *rhs.old_data, 0, 0, desc->nComp(),desc->nExtra());
+        }
     }
 }
 
@@ -113,10 +226,9 @@ StateData::define (const Box&             p_domain,
         old_time.start = time-dt;
         old_time.stop  = time;
     }
-    int ncomp = desc->nComp();
-
-    new_data.reset(new MultiFab(grids,dmap,ncomp,desc->nExtra(), MFInfo(), *m_factory));
-    old_data.reset();
+    releaseData(new_data);
+    releaseData(old_data);
+    new_data = allocData();
 }
 
 void
@@ -129,8 +241,17 @@ StateData::copyOld (const StateData& state)
     
     BL_ASSERT(nc == (*old_data).nComp());
     BL_ASSERT(ng == (*old_data).nGrow());
-    
-    MultiFab::Copy(*old_data, state.oldData(), 0, 0, nc, ng);
+
+    Initialize();
+    if (copy_on_write && canShare(MF)) {
+        if (old_data != state.old_data) {
+            releaseData(old_data);
+            old_data = state.old_data;
+        }
+    } else {
+        makeUnique(old_data);
+        MultiFab::Copy(*old_data, MF, 0, 0, nc, ng);
+    }
     
     old_time = state.old_time;
 }
@@ -145,8 +266,17 @@ StateData::copyNew (const StateData& state)
     
     BL_ASSERT(nc == (*new_data).nComp());
     BL_ASSERT(ng == (*new_data).nGrow());
-    
-    MultiFab::Copy(*new_data, state.newData(), 0, 0, nc, ng);
+
+    Initialize();
+    if (copy_on_write && canShare(MF)) {
+        if (new_data != state.new_data) {
+            releaseData(new_data);
+            new_data = state.new_data;
+        }
+    } else {
+        makeUnique(new_data);
+        MultiFab::Copy(*new_data, MF, 0, 0, nc, ng);
+    }
 
     new_time = state.new_time;
 }
@@ -279,6 +409,8 @@ StateData::restart (const StateDescriptor& d,
 
 StateData::~StateData()
 {
+    releaseData(new_data);
+    releaseData(old_data);
     desc = nullptr;
 }
 
@@ -287,7 +419,7 @@ StateData::allocOldData ()
 {
     if (old_data == nullptr)
     {
-        old_data.reset(new MultiFab(grids,dmap,desc->nComp(),desc->nExtra(), MFInfo(), *m_factory));
+        old_data = allocData();
     }
 }
 
@@ -64,6 +64,8 @@ AmrMesh::InitAmrMesh (int max_level_in, const Vector<int>& n_cell_in, std::vecto
 
     use_new_chop         = false;
     iterate_on_new_grids = true;
+    local_clustering     = false;
+    incremental_regrid   = false;
 
     ParmParse pp("amr");
 
@@ -102,6 +104,8 @@ AmrMesh::InitAmrMesh (int max_level_in, const Vector<int>& n_cell_in, std::vecto
 
     pp.query("n_proper",n_proper);
     pp.query("grid_eff",grid_eff);
+    pp.query("local_clustering",local_clustering);
+    pp.query("incremental_regrid",incremental_regrid);
     int cnt = pp.countval("n_error_buf");
     if (cnt > 0) {
         pp.getarr("n_error_buf",n_error_buf);
@@ -398,8 +402,315 @@ AmrMesh::MakeBaseGrids () const
 }
 
 
+namespace {
+bool SameBoxes (const BoxArray& a, const BoxArray& b)
+{
+    if (a.size() != b.size() || a.numPts() != b.numPts()) return false;
+    std::vector< std::pair<int,Box> > isects;
+    for (int i = 0, N = a.size(); i < N; ++i) {
+        b.intersections(a[i], isects);
+        bool found = false;
+        for (const auto& is : isects) {
+            if (b[is.first] == a[i]) {
+                found = true;
+                break;
+            }
+        }
+        if (!found) return false;
+    }
+    return true;
+}
+}
+
+void
+AmrMesh::ClusterTags (Vector<IntVect>& tagvec, const BoxList& p_n, BoxList& new_bx) const
+{
+    //
+    // Construct initial cluster.
+    //
+    ClusterList clist(&tagvec[0], tagvec.size());
+    if (use_new_chop)
+    {
+       clist.new_chop(grid_eff);
+    } else {
+       clist.chop(grid_eff);
+    }
+    BoxDomain bd;
+    bd.add(p_n);
+    clist.intersect(bd);
+    bd.clear();
+    //
+    // Efficient properly nested Clusters have been constructed
+    // now generate list of grids at level levf.
+    //
+    clist.boxList(new_bx);
+}
+
+void
+AmrMesh::ClusterKeepingGrids (int levf, const IntVect& bf, const BoxList& p_n,
+                              const Vector<IntVect>& tagvec, BoxList& new_bx,
+                              BoxList& kept_bx) const
+{
+    BL_PROFILE("AmrMesh::ClusterKeepingGrids()");
+
+    const IntVect rr = ref_ratio[levf-1]*bf;
+    const BoxArray& ba = grids[levf];
+
+    // The current grids in the space of the tags
+    BoxList bl;
+    Vector<int> index;
+    for (int i = 0, N = ba.size(); i < N; ++i) {
+        if (ba[i].coarsenable(rr)) {
+            bl.push_back(amrex::coarsen(ba[i],rr));
+            index.push_back(i);
+        }
+    }
+    const BoxArray cba(std::move(bl));
+    const int N = cba.size();
+
+    // The grid of each tag, or -1
+    Vector<int> tag_grid(tagvec.size(), -1);
+    Vector<long> ntags(N, 0L);
+    if (N > 0)
+    {
+        std::vector< std::pair<int,Box> > isects;
+        for (int i = 0, M = tagvec.size(); i < M; ++i) {
+            cba.intersections(Box(tagvec[i],tagvec[i]), isects, true, 0);
+            if (!isects.empty()) {
+                tag_grid[i] = isects[0].first;
+                ++ntags[tag_grid[i]];
+            }
+        }
+    }
+
+    // Candidates are properly nested and efficient enough.
+    const BoxArray pnba(p_n);
+    Vector<int> keep(N, 0);
+    for (int i = 0; i < N; ++i) {
+        keep[i] = ntags[i] > 0 && ntags[i] >= grid_eff*cba[i].numPts() && pnba.contains(cba[i]);
+    }
+
+    //
+    // Cluster the tags outside the kept grids.  A kept grid that
+    // intersects the new clusters is given up, and its tags are clustered
+    // too, so the grids are not cut into pieces.
+    //
+    Vector<IntVect> rest;
+    while (true)
+    {
+        rest.clear();
+        for (int i = 0, M = tagvec.size(); i < M; ++i) {
+            if (tag_grid[i] < 0 || !keep[tag_grid[i]]) rest.push_back(tagvec[i]);
+        }
+
+        new_bx.clear();
+        if (rest.empty()) break;
+        ClusterTags(rest, p_n, new_bx);
+
+        const BoxArray nba(new_bx);
+        bool changed = false;
+        for (int i = 0; i < N; ++i) {
+            if (keep[i] && nba.intersects(cba[i])) {
+                keep[i] = 0;
+                changed = true;
+            }
+        }
+        if (!changed) break;
+    }
+
+    kept_bx.clear();
+    long kept_cells = 0;
+    for (int i = 0; i < N; ++i) {
+        if (keep[i]) {
+            kept_bx.push_back(ba[index[i]]);
+            kept_cells += cba[i].numPts();
+        }
+    }
+    if (kept_bx.isEmpty()) return;
+
+    //
+    // Over many regrids, the kept grids can become a patchwork of more
+    // boxes than a fresh clustering would give.  They are all given up if
+    // they give more than 25% more boxes or 10% more cells.  The boxes are
+    // counted after they are chopped by max_grid_size.
+    //
+    IntVect max_tag_size = max_grid_size[levf] / rr;
+    max_tag_size.max(IntVect::TheUnitVector());
+
+    BoxList incr(new_bx);
+    incr.maxSize(max_tag_size);
+    long incr_boxes = kept_bx.size() + incr.size();
+    long incr_cells = kept_cells;
+    for (const Box& b : incr) incr_cells += b.numPts();
+
+    Vector<IntVect> all(tagvec);
+    BoxList full;
+    ClusterTags(all, p_n, full);
+    BoxList full_chopped(full);
+    full_chopped.maxSize(max_tag_size);
+    long full_cells = 0;
+    for (const Box& b : full_chopped) full_cells += b.numPts();
+
+    if (incr_boxes > 1.25*full_chopped.size() || incr_cells > 1.1*full_cells)
+    {
+        new_bx = std::move(full);
+        kept_bx.clear();
+    }
+}
+
 void
 AmrMesh::MakeNewGrids (int lbase, Real time, int& new_finest, Vector<BoxArray>& new_grids)
+{
+    MakeNewGrids(lbase, time, new_finest, new_grids, nullptr);
+}
+
+void
+AmrMesh::MakeNewGridTags (int lbase, Real time, DeferredClustering& dc)
+{
+    BL_ASSERT(lbase == std::min(finest_level, max_level-1));
+    BL_ASSERT(!local_clustering);
+
+    int new_finest;
+    Vector<BoxArray> new_grids;
+    MakeNewGrids(lbase, time, new_finest, new_grids, &dc);
+}
+
+void
+AmrMesh::ClusterDeferredTags (DeferredClustering& dc) const
+{
+    dc.new_bx.clear();
+    if (dc.ntags > 0) {
+        ClusterNewGrids(dc.levc, dc.bf, dc.p_n, dc.tagvec, dc.new_bx);
+    }
+}
+
+void
+AmrMesh::FinishNewGrids (const DeferredClustering& dc, int& new_finest, Vector<BoxArray>& new_grids)
+{
+    const int levc = dc.levc;
+    const int levf = levc+1;
+
+    if (new_grids.size() < levf+1) new_grids.resize(levf+1);
+
+    new_finest = dc.new_finest;
+    if (dc.ntags > 0)
+    {
+        if ( !(useFixedCoarseGrids() && levc<useFixedUpToLevel()) ) {
+            new_finest = std::max(new_finest,levf);
+        }
+        if(levf > useFixedUpToLevel()) {
+            new_grids[levf].define(dc.new_bx);
+        }
+    }
+
+    ChopNewGrids(levc, new_finest, new_grids);
+}
+
+void
+AmrMesh::ClusterNewGrids (int levc, const IntVect& bf, const BoxList& p_n,
+                          Vector<IntVect>& tagvec, BoxList& new_bx) const
+{
+    const int levf = levc+1;
+
+    BoxList kept_bx;
+    if (tagvec.size() > 0)
+    {
+        if (incremental_regrid && !local_clustering && levf <= finest_level)
+        {
+            //
+            // Keep the current grids that still fit the tags, and
+            // cluster only the other tags.
+            //
+            ClusterKeepingGrids(levf, bf, p_n, tagvec, new_bx, kept_bx);
+        }
+        else
+        {
+            ClusterTags(tagvec, p_n, new_bx);
+        }
+    }
+
+    if (local_clustering)
+    {
+        //
+        // Only the boxes are gathered.  The clusters of different
+        // processes may overlap where they share tags.  We are
+        // still in the space coarsened by the blocking factor, so
+        // the pieces are aligned with it.
+        //
+        Vector<Box> bxs(std::move(new_bx.data()));
+        amrex::AllGatherBoxes(bxs);
+        if (bxs.empty()) {
+            new_bx.clear();
+        } else {
+            new_bx = amrex::removeOverlap(BoxList(std::move(bxs)));
+        }
+    }
+
+    new_bx.refine(bf);
+    new_bx.simplify();
+    BL_ASSERT(new_bx.isDisjoint());
+
+    if (new_bx.size()>0) {
+        if ( !(Geom(levc).Domain().contains(BoxArray(new_bx).minimalBox())) ) {
+            // Chop new grids outside domain, note that this is likely to result in
+            //  new grids that violate blocking_factor....see warning checking below
+            new_bx = amrex::intersect(new_bx,Geom(levc).Domain());
+        }
+    }
+
+    const IntVect& largest_grid_size = max_grid_size[levf] / ref_ratio[levc];
+    //
+    // Ensure new grid boxes are at most max_grid_size in index dirs.
+    //
+    new_bx.maxSize(largest_grid_size);
+
+    //
+    // Refine up to levf.
+    //
+    new_bx.refine(ref_ratio[levc]);
+    BL_ASSERT(new_bx.isDisjoint());
+
+    if (new_bx.size()>0) {
+        if ( !(Geom(levf).Domain().contains(BoxArray(new_bx).minimalBox())) ) {
+            new_bx = amrex::intersect(new_bx,Geom(levf).Domain());
+        }
+    }
+
+    if (!kept_bx.isEmpty()) {
+        kept_bx.join(new_bx);
+        new_bx = std::move(kept_bx);
+    }
+}
+
+void
+AmrMesh::ChopNewGrids (int lbase, int new_finest, Vector<BoxArray>& new_grids) const
+{
+    for (int lev = lbase+1; lev <= new_finest; ++lev) {
+        if (new_grids[lev].empty())
+        {
+            if (!(useFixedCoarseGrids() && lev<useFixedUpToLevel()) ) {
+                amrex::Abort("AmrMesh::MakeNewGrids: how did this happen?");
+            }
+        }
+        else if (refine_grid_layout)
+        {
+            ChopGrids(lev,new_grids[lev],ParallelDescriptor::NProcs());
+            if (new_grids[lev] == grids[lev]) {
+                new_grids[lev] = grids[lev]; // to avoid dupliates
+            }
+        }
+
+        if (incremental_regrid && lev <= finest_level && !new_grids[lev].empty()
+            && new_grids[lev] != grids[lev] && SameBoxes(new_grids[lev], grids[lev]))
+        {
+            new_grids[lev] = grids[lev]; // the same boxes in another order
+        }
+    }
+}
+
+void
+AmrMesh::MakeNewGrids (int lbase, Real time, int& new_finest, Vector<BoxArray>& new_grids,
+                       DeferredClustering* dc)
 {
     BL_PROFILE("AmrMesh::MakeNewGrids()");
 
@@ -621,13 +932,38 @@ AmrMesh::MakeNewGrids (int lbase, Real time, int& new_finest, Vector<BoxArray>&
         //
         tags.setVal(p_n_comp[levc],TagBox::CLEAR);
         //
-        // Create initial cluster containing all tagged points.
+        // Create initial cluster containing all tagged points.  With
+        // local_clustering, each process only has its own tags.
         //
 	Vector<IntVect> tagvec;
-	tags.collate(tagvec);
+        if (local_clustering) {
+            tags.local_collate(tagvec);
+        } else {
+            tags.collate(tagvec);
+        }
         tags.clear();
 
-        if (tagvec.size() > 0)
+        long ntags = tagvec.size();
+        if (local_clustering) {
+            ParallelDescriptor::ReduceLongSum(ntags);
+        }
+
+        if (dc != nullptr)
+        {
+            //
+            // levc == lbase is the only level.  The tags are clustered
+            // later by ClusterDeferredTags.
+            //
+            dc->levc = levc;
+            dc->new_finest = new_finest;
+            dc->ntags = ntags;
+            dc->bf = bf_lev[levc];
+            dc->p_n = p_n[levc];
+            dc->tagvec = std::move(tagvec);
+            return;
+        }
+
+        if (ntags > 0)
         {
             //
             // Created new level, now generate efficient grids.
@@ -635,55 +971,9 @@ AmrMesh::MakeNewGrids (int lbase, Real time, int& new_finest, Vector<BoxArray>&
             if ( !(useFixedCoarseGrids() && levc<useFixedUpToLevel()) ) {
                 new_finest = std::max(new_finest,levf);
 	    }
-            //
-            // Construct initial cluster.
-            //
-            ClusterList clist(&tagvec[0], tagvec.size());
-            if (use_new_chop)
-            {
-               clist.new_chop(grid_eff);
-            } else {
-               clist.chop(grid_eff);
-            }
-            BoxDomain bd;
-            bd.add(p_n[levc]);
-            clist.intersect(bd);
-            bd.clear();
-            //
-            // Efficient properly nested Clusters have been constructed
-            // now generate list of grids at level levf.
-            //
-            BoxList new_bx;
-            clist.boxList(new_bx);
-            new_bx.refine(bf_lev[levc]);
-            new_bx.simplify();
-            BL_ASSERT(new_bx.isDisjoint());
-
-	    if (new_bx.size()>0) {
-		if ( !(Geom(levc).Domain().contains(BoxArray(new_bx).minimalBox())) ) {
-		// Chop new grids outside domain, note that this is likely to result in
-		//  new grids that violate blocking_factor....see warning checking below
-		    new_bx = amrex::intersect(new_bx,Geom(levc).Domain());
-		}
-	    }
 
-            const IntVect& largest_grid_size = max_grid_size[levf] / ref_ratio[levc];
-            //
-            // Ensure new grid boxes are at most max_grid_size in index dirs.
-            //
-            new_bx.maxSize(largest_grid_size);
-
-            //
-            // Refine up to levf.
-            //
-            new_bx.refine(ref_ratio[levc]);
-            BL_ASSERT(new_bx.isDisjoint());
-
-	    if (new_bx.size()>0) {
-		if ( !(Geom(levf).Domain().contains(BoxArray(new_bx).minimalBox())) ) {
-		    new_bx = amrex::intersect(new_bx,Geom(levf).Domain());
-		}
-	    }
+            BoxList new_bx;
+            ClusterNewGrids(levc, bf_lev[levc], p_n[levc], tagvec, new_bx);
 
             if(levf > useFixedUpToLevel()) {
               new_grids[levf].define(new_bx);
@@ -691,21 +981,7 @@ AmrMesh::MakeNewGrids (int lbase, Real time, int& new_finest, Vector<BoxArray>&
         }
     }
 
-    for (int lev = lbase+1; lev <= new_finest; ++lev) {
-        if (new_grids[lev].empty())
-        {
-            if (!(useFixedCoarseGrids() && lev<useFixedUpToLevel()) ) {
-                amrex::Abort("AmrMesh::MakeNewGrids: how did this happen?");
-            }
-        }
-        else if (refine_grid_layout)
-        {
-            ChopGrids(lev,new_grids[lev],ParallelDescriptor::NProcs());
-            if (new_grids[lev] == grids[lev]) {
-                new_grids[lev] = grids[lev]; // to avoid dupliates
-            }
-        }
-    }
+    ChopNewGrids(lbase, new_finest, new_grids);
 }
 
 void
@@ -14,6 +14,93 @@
 
 namespace amrex
 {
+    namespace
+    {
+	// Linear interpolation in time from the two levels of smf into dmf,
+	// which has the same layout
+	void timeInterp (MultiFab& dmf, int dcomp, Real time,
+			 const Vector<MultiFab*>& smf, const Vector<Real>& stime,
+			 int scomp, int ncomp)
+	{
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+	    for (MFIter mfi(dmf,TilingIfNotGPU()); mfi.isValid(); ++mfi)
+	    {
+		const Box& bx = mfi.tilebox();
+                const Real t0 = stime[0];
+                const Real t1 = stime[1];
+                auto const sfab0 = smf[0]->array(mfi);
+                auto const sfab1 = smf[1]->array(mfi);
+                auto       dfab  = dmf.array(mfi);
+
+                if (std::abs(t1-t0) > 1.e-16)
+                {
+                    Real alpha = (t1-time)/(t1-t0);
+                    Real beta = (time-t0)/(t1-t0);
+                    AMREX_HOST_DEVICE_FOR_4D ( bx, ncomp, i, j, k, n,
+                    {
+                        dfab(i,j,k,n+dcomp) = alpha*sfab0(i,j,k,n+scomp)
+                            +                  beta*sfab1(i,j,k,n+scomp);
+                    });
+                }
+                else
+                {
+                    AMREX_HOST_DEVICE_FOR_4D ( bx, ncomp, i, j, k, n,
+                    {
+                        dfab(i,j,k,n+dcomp) = sfab0(i,j,k,n+scomp);
+                    });
+                }
+	    }
+	}
+
+	// Starts the copy of the sources at time into mf, which is done by
+	// mf.ParallelCopy_finish.  With two times, the sources are first
+	// interpolated in time, in place if mf has the same layout, or
+	// else into tmp.
+	void startSingleLevel (MultiFab& mf, Real time,
+			       const Vector<MultiFab*>& smf, const Vector<Real>& stime,
+			       int scomp, int dcomp, int ncomp, const Geometry& geom,
+			       std::unique_ptr<MultiFab>& tmp)
+	{
+	    BL_ASSERT(scomp+ncomp <= smf[0]->nComp());
+	    BL_ASSERT(dcomp+ncomp <= mf.nComp());
+	    BL_ASSERT(smf.size() == stime.size());
+	    BL_ASSERT(smf.size() != 0);
+
+	    const IntVect dst_ngrow(mf.nGrow());
+
+	    if (smf.size() == 1)
+	    {
+		mf.ParallelCopy_nowait(*smf[0], scomp, dcomp, ncomp, IntVect(0), dst_ngrow,
+				       geom.periodicity());
+	    }
+	    else if (smf.size() == 2)
+	    {
+		BL_ASSERT(smf[0]->boxArray() == smf[1]->boxArray());
+		if (mf.boxArray() == smf[0]->boxArray() &&
+		    mf.DistributionMap() == smf[0]->DistributionMap())
+		{
+		    // The copy from itself fills the ghost cells only.
+		    timeInterp(mf, dcomp, time, smf, stime, scomp, ncomp);
+		    mf.ParallelCopy_nowait(mf, dcomp, dcomp, ncomp, IntVect(0), dst_ngrow,
+					   geom.periodicity());
+		}
+		else
+		{
+		    tmp.reset(new MultiFab(smf[0]->boxArray(), smf[0]->DistributionMap(), ncomp, 0,
+					   MFInfo(), smf[0]->Factory()));
+		    timeInterp(*tmp, 0, time, smf, stime, scomp, ncomp);
+		    mf.ParallelCopy_nowait(*tmp, 0, dcomp, ncomp, IntVect(0), dst_ngrow,
+					   geom.periodicity());
+		}
+	    }
+	    else {
+		amrex::Abort("FillPatchTwoLevels: high-order interpolation in time not implemented yet");
+	    }
+	}
+    }
+
     bool ProperlyNested (const IntVect& ratio, const IntVect& blocking_factor, int ngrow,
 			 const IndexType& boxType, Interpolater* mapper)
     {
@@ -76,36 +163,7 @@ namespace amrex
 		sameba = false;
 	    }
 
-#ifdef _OPENMP
-#pragma omp parallel if (Gpu::notInLaunchRegion())
-#endif
-	    for (MFIter mfi(*dmf,TilingIfNotGPU()); mfi.isValid(); ++mfi)
-	    {
-		const Box& bx = mfi.tilebox();
-                const Real t0 = stime[0];
-                const Real t1 = stime[1];
-                auto const sfab0 = smf[0]->array(mfi);
-                auto const sfab1 = smf[1]->array(mfi);
-                auto       dfab  = dmf->array(mfi);
-
-                if (std::abs(t1-t0) > 1.e-16)
-                {
-                    Real alpha = (t1-time)/(t1-t0);
-                    Real beta = (time-t0)/(t1-t0);
-                    AMREX_HOST_DEVICE_FOR_4D ( bx, ncomp, i, j, k, n,
-                    {
-                        dfab(i,j,k,n+destcomp) = alpha*sfab0(i,j,k,n+scomp)
-                            +                     beta*sfab1(i,j,k,n+scomp);
-                    });
-                }
-                else
-                {
-                    AMREX_HOST_DEVICE_FOR_4D ( bx, ncomp, i, j, k, n,
-                    {
-                        dfab(i,j,k,n+destcomp) = sfab0(i,j,k,n+scomp);
-                    });
-                }
-	    }
+	    timeInterp(*dmf, destcomp, time, smf, stime, scomp, ncomp);
 
 	    if (sameba)
 	    {
@@ -143,6 +201,83 @@ namespace amrex
     {
 	BL_PROFILE("FillPatchTwoLevels");
 
+        FillPatchHandle h = FillPatchTwoLevels_nowait(mf, time, cmf, ct, fmf, ft,
+                                                      scomp, dcomp, ncomp, cgeom, fgeom,
+                                                      cbc, cbccomp, fbc, fbccomp,
+                                                      ratio, mapper, bcs, bcscomp);
+        h.wait(pre_interp, post_interp);
+    }
+
+    struct FillPatchHandle::State
+    {
+        MultiFab* mf;
+        Real time;
+        int dcomp;
+        int ncomp;
+        Geometry cgeom;
+        Geometry fgeom;
+        PhysBCFunctBase* cbc;
+        int cbccomp;
+        PhysBCFunctBase* fbc;
+        int fbccomp;
+        IntVect ratio;
+        Interpolater* mapper;
+        Vector<BCRec> bcs;
+        int bcscomp;
+        Box fdomain;
+        const FabArrayBase::FPinfo* fpc;
+        std::unique_ptr<MultiFab> crse_patch;
+        std::unique_ptr<MultiFab> crse_tmp;
+        std::unique_ptr<MultiFab> fine_tmp;
+        // Kept coarse patches at times ct, some of them still being copied
+        Vector<MultiFab*> kept_patch;
+        Vector<Real> ct;
+    };
+
+    FillPatchHandle::FillPatchHandle () noexcept {}
+
+    FillPatchHandle::FillPatchHandle (FillPatchHandle&& rhs) noexcept
+        : m_state(std::move(rhs.m_state))
+    {}
+
+    FillPatchHandle::~FillPatchHandle ()
+    {
+        if (m_state) wait();
+    }
+
+    FillPatchHandle FillPatchTwoLevels_nowait (MultiFab& mf, Real time,
+                                               const Vector<MultiFab*>& cmf, const Vector<Real>& ct,
+                                               const Vector<MultiFab*>& fmf, const Vector<Real>& ft,
+                                               int scomp, int dcomp, int ncomp,
+                                               const Geometry& cgeom, const Geometry& fgeom,
+                                               PhysBCFunctBase& cbc, int cbccomp,
+                                               PhysBCFunctBase& fbc, int fbccomp,
+                                               const IntVect& ratio,
+                                               Interpolater* mapper,
+                                               const Vector<BCRec>& bcs, int bcscomp,
+                                               FillPatchCrseCache* crse_cache)
+    {
+	BL_PROFILE("FillPatchTwoLevels_nowait");
+
+        FillPatchHandle h;
+        h.m_state.reset(new FillPatchHandle::State);
+        FillPatchHandle::State& st = *h.m_state;
+        st.mf      = &mf;
+        st.time    = time;
+        st.dcomp   = dcomp;
+        st.ncomp   = ncomp;
+        st.cgeom   = cgeom;
+        st.fgeom   = fgeom;
+        st.cbc     = &cbc;
+        st.cbccomp = cbccomp;
+        st.fbc     = &fbc;
+        st.fbccomp = fbccomp;
+        st.ratio   = ratio;
+        st.mapper  = mapper;
+        st.bcs     = bcs;
+        st.bcscomp = bcscomp;
+        st.fpc     = nullptr;
+
 	int ngrow = mf.nGrow();
 
 	if (ngrow > 0 || mf.getBDKey() != fmf[0]->getBDKey())
@@ -157,6 +292,7 @@ namespace amrex
 		    fdomain_g.grow(i,ngrow);
 		}
 	    }
+            st.fdomain = fdomain;
 
 	    const FabArrayBase::FPinfo& fpc = FabArrayBase::TheFPinfo(*fmf[0], mf, fdomain_g,
                                                                       IntVect(ngrow),
@@ -165,54 +301,147 @@ namespace amrex
 
 	    if ( ! fpc.ba_crse_patch.empty())
 	    {
-		MultiFab mf_crse_patch(fpc.ba_crse_patch, fpc.dm_crse_patch, ncomp, 0, MFInfo(),
-                                       *fpc.fact_crse_patch);
+                st.fpc = &fpc;
 
-                mf_crse_patch.setDomainBndry(std::numeric_limits<Real>::quiet_NaN(), cgeom);
+		st.crse_patch.reset(new MultiFab(fpc.ba_crse_patch, fpc.dm_crse_patch, ncomp, 0,
+                                                 MFInfo(), *fpc.fact_crse_patch));
 
-		FillPatchSingleLevel(mf_crse_patch, time, cmf, ct, scomp, 0, ncomp, cgeom, cbc, cbccomp);
+                if (crse_cache == nullptr)
+                {
+                    st.crse_patch->setDomainBndry(std::numeric_limits<Real>::quiet_NaN(), cgeom);
 
-		int idummy1=0, idummy2=0;
-		bool cc = fpc.ba_crse_patch.ixType().cellCentered();
-                ignore_unused(cc);
-#ifdef _OPENMP
-#pragma omp parallel if (cc && Gpu::notInLaunchRegion())
-#endif
+                    startSingleLevel(*st.crse_patch, time, cmf, ct, scomp, 0, ncomp, cgeom, st.crse_tmp);
+                }
+                else
                 {
-                    Vector<BCRec> bcr(ncomp);
-                    for (MFIter mfi(mf_crse_patch); mfi.isValid(); ++mfi)
+                    // The copy commutes with the interpolation in time, so
+                    // the coarse data at each time are copied to their own
+                    // patch and kept.
+                    BL_ASSERT(cmf.size() == ct.size());
+                    if (cmf.size() > 2) {
+                        amrex::Abort("FillPatchTwoLevels: high-order interpolation in time not implemented yet");
+                    }
+                    st.ct = ct;
+                    for (const MultiFab* c : cmf)
                     {
-                        FArrayBox& sfab = mf_crse_patch[mfi];
-                        int li = mfi.LocalIndex();
-                        int gi = fpc.dst_idxs[li];
-                        FArrayBox& dfab = mf[gi];
-                        const Box& dbx = fpc.dst_boxes[li] & dfab.box();
-
-                        amrex::setBC(dbx,fdomain,bcscomp,0,ncomp,bcs,bcr);
-
-                        pre_interp(sfab, sfab.box(), 0, ncomp);
-                        
-                        FArrayBox const* sfabp = mf_crse_patch.fabPtr(mfi);
-                        FArrayBox* dfabp = mf.fabPtr(gi);
-                        mapper->interp(*sfabp,
-                                       0,
-                                       *dfabp,
-                                       dcomp,
-                                       ncomp,
-                                       dbx,
-                                       ratio,
-                                       cgeom,
-                                       fgeom,
-                                       bcr,
-                                       idummy1, idummy2);
-
-                        post_interp(dfab, dbx, dcomp, ncomp);
+                        FillPatchCrseCache::Entry* entry = nullptr;
+                        for (auto const& e : crse_cache->m_entries)
+                        {
+                            if (e->fpc == &fpc && e->src_bdk == fmf[0]->getBDKey() &&
+                                e->dst_bdk == mf.getBDKey() && e->crse == c &&
+                                e->crse_bdk == c->getBDKey() &&
+                                e->scomp == scomp && e->ncomp == ncomp)
+                            {
+                                entry = e.get();
+                                break;
+                            }
+                        }
+
+                        if (entry == nullptr)
+                        {
+                            entry = new FillPatchCrseCache::Entry{&fpc, fmf[0]->getBDKey(),
+                                                                  mf.getBDKey(), c, c->getBDKey(),
+                                                                  scomp, ncomp, nullptr};
+                            crse_cache->m_entries.emplace_back(entry);
+                            entry->patch.reset(new MultiFab(fpc.ba_crse_patch, fpc.dm_crse_patch,
+                                                            ncomp, 0, MFInfo(), *fpc.fact_crse_patch));
+                            entry->patch->setDomainBndry(std::numeric_limits<Real>::quiet_NaN(), cgeom);
+                            entry->patch->ParallelCopy_nowait(*c, scomp, 0, ncomp, IntVect(0), IntVect(0),
+                                                              cgeom.periodicity());
+                        }
+
+                        st.kept_patch.push_back(entry->patch.get());
                     }
                 }
 	    }
 	}
 
-	FillPatchSingleLevel(mf, time, fmf, ft, scomp, dcomp, ncomp, fgeom, fbc, fbccomp);
+        // The interpolation may write to ghost cells that are also filled
+        // from the fine level across periodic boundaries, so mf is not
+        // touched by the fine copy until the interpolation is done.
+        startSingleLevel(mf, time, fmf, ft, scomp, dcomp, ncomp, fgeom, st.fine_tmp);
+
+        return h;
+    }
+
+    void
+    FillPatchHandle::wait (const InterpHook& pre_interp, const InterpHook& post_interp)
+    {
+        if (!m_state) return;
+
+	BL_PROFILE("FillPatchHandle::wait()");
+
+        std::unique_ptr<State> st = std::move(m_state);
+        MultiFab& mf = *st->mf;
+        const int dcomp = st->dcomp;
+        const int ncomp = st->ncomp;
+
+        if (st->crse_patch)
+        {
+            MultiFab& mf_crse_patch = *st->crse_patch;
+            const FabArrayBase::FPinfo& fpc = *st->fpc;
+            Interpolater* mapper = st->mapper;
+
+            if (st->kept_patch.empty())
+            {
+                mf_crse_patch.ParallelCopy_finish();
+                st->crse_tmp.reset();
+            }
+            else
+            {
+                for (MultiFab* p : st->kept_patch) {
+                    p->ParallelCopy_finish();
+                }
+                if (st->kept_patch.size() == 1) {
+                    MultiFab::Copy(mf_crse_patch, *st->kept_patch[0], 0, 0, ncomp, 0);
+                } else {
+                    timeInterp(mf_crse_patch, 0, st->time, st->kept_patch, st->ct, 0, ncomp);
+                }
+            }
+            st->cbc->FillBoundary(mf_crse_patch, 0, ncomp, st->time, st->cbccomp);
+
+            int idummy1=0, idummy2=0;
+            bool cc = fpc.ba_crse_patch.ixType().cellCentered();
+            ignore_unused(cc);
+#ifdef _OPENMP
+#pragma omp parallel if (cc && Gpu::notInLaunchRegion())
+#endif
+            {
+                Vector<BCRec> bcr(ncomp);
+                for (MFIter mfi(mf_crse_patch); mfi.isValid(); ++mfi)
+                {
+                    FArrayBox& sfab = mf_crse_patch[mfi];
+                    int li = mfi.LocalIndex();
+                    int gi = fpc.dst_idxs[li];
+                    FArrayBox& dfab = mf[gi];
+                    const Box& dbx = fpc.dst_boxes[li] & dfab.box();
+
+                    amrex::setBC(dbx,st->fdomain,st->bcscomp,0,ncomp,st->bcs,bcr);
+
+                    pre_interp(sfab, sfab.box(), 0, ncomp);
+
+                    FArrayBox const* sfabp = mf_crse_patch.fabPtr(mfi);
+                    FArrayBox* dfabp = mf.fabPtr(gi);
+                    mapper->interp(*sfabp,
+                                   0,
+                                   *dfabp,
+                                   dcomp,
+                                   ncomp,
+                                   dbx,
+                                   st->ratio,
+                                   st->cgeom,
+                                   st->fgeom,
+                                   bcr,
+                                   idummy1, idummy2);
+
+                    post_interp(dfab, dbx, dcomp, ncomp);
+                }
+            }
+        }
+
+        mf.ParallelCopy_finish();
+
+        st->fbc->FillBoundary(mf, dcomp, ncomp, st->time, st->fbccomp);
     }
 
     void InterpFromCoarseLevel (MultiFab& mf, Real time, const MultiFab& cmf,
@@ -7,10 +7,34 @@
 #include <AMReX_BLProfiler.H>
 #include <AMReX_iMultiFab.H>
 
+#include <algorithm>
 #include <vector>
 
 namespace amrex {
 
+namespace {
+
+// The coarse cells next to the nodes of a register on face
+Box
+RefluxCells (const Box& nodes, const Orientation& face)
+{
+    Box bx(nodes.smallEnd(), nodes.bigEnd());
+    if (face.isLow()) bx.shift(face.coordDir(), -1);
+    return bx;
+}
+
+// The nodes of a register on face next to the coarse cells
+Box
+RefluxNodes (const Box& cells, const Orientation& face)
+{
+    const int dir = face.coordDir();
+    Box bx(cells.smallEnd(), cells.bigEnd(), IndexType(IntVect::TheDimensionVector(dir)));
+    if (face.isLow()) bx.shift(dir, 1);
+    return bx;
+}
+
+}
+
 FluxRegister::FluxRegister ()
 {
     fine_level = ncomp = -1;
@@ -92,6 +116,7 @@ void
 FluxRegister::clear ()
 {
     BndryRegister::clear();
+    m_reflux_plan.reset();
 }
 
 FluxRegister::~FluxRegister () {}
@@ -435,6 +460,94 @@ FluxRegister::FineSetVal (int              dir,
     hireg.setVal(val, hireg.box(), destcomp, numcomp);
 }
 
+bool
+FluxRegister::RefluxTag::operator< (const RefluxTag& rhs) const
+{
+    if (srcIndex != rhs.srcIndex) return srcIndex < rhs.srcIndex;
+    if (face     != rhs.face    ) return int(face) < int(rhs.face);
+    if (dstIndex != rhs.dstIndex) return dstIndex < rhs.dstIndex;
+    return dbox.smallEnd() < rhs.dbox.smallEnd();
+}
+
+const FluxRegister::RefluxPlan&
+FluxRegister::getRefluxPlan (const BoxArray& crse_ba,
+                             const DistributionMapping& crse_dm,
+                             const Periodicity& period)
+{
+    if (m_reflux_plan &&
+        m_reflux_plan->crse_ba == crse_ba &&
+        m_reflux_plan->crse_dm == crse_dm &&
+        m_reflux_plan->period  == period)
+    {
+        return *m_reflux_plan;
+    }
+
+    BL_PROFILE("FluxRegister::getRefluxPlan()");
+
+    m_reflux_plan.reset(new RefluxPlan);
+    RefluxPlan& plan = *m_reflux_plan;
+    plan.crse_ba = crse_ba;
+    plan.crse_dm = crse_dm;
+    plan.period  = period;
+
+    const int MyProc = ParallelDescriptor::MyProc();
+    const std::vector<IntVect>& pshifts = period.shiftIntVect();
+    std::vector< std::pair<int,Box> > isects;
+
+    for (OrientationIter fi; fi; ++fi)
+    {
+        const Orientation face = fi();
+        const BoxArray& fba = bndry[face].boxArray();
+        const DistributionMapping& fdm = bndry[face].DistributionMap();
+
+        // The registers owned by this process
+        for (FabSetIter fsi(bndry[face]); fsi.isValid(); ++fsi)
+        {
+            const int k_src = fsi.index();
+            const Box& cbx = RefluxCells(fba[k_src], face);
+            for (const auto& iv : pshifts)
+            {
+                crse_ba.intersections(cbx+iv, isects);
+                for (const auto& is : isects)
+                {
+                    const int dst_owner = crse_dm[is.first];
+                    RefluxTag tag{is.second, iv, is.first, k_src, face};
+                    if (dst_owner == MyProc) {
+                        plan.loc_tags.push_back(tag);
+                    } else {
+                        plan.snd_tags[dst_owner].push_back(tag);
+                    }
+                }
+            }
+        }
+
+        // The coarse fabs owned by this process
+        for (int k_dst = 0, N = crse_ba.size(); k_dst < N; ++k_dst)
+        {
+            if (crse_dm[k_dst] != MyProc) continue;
+            const Box& nbx = RefluxNodes(crse_ba[k_dst], face);
+            for (const auto& iv : pshifts)
+            {
+                fba.intersections(nbx-iv, isects);
+                for (const auto& is : isects)
+                {
+                    const int src_owner = fdm[is.first];
+                    if (src_owner != MyProc) {
+                        plan.rcv_tags[src_owner].push_back
+                            (RefluxTag{RefluxCells(is.second,face)+iv, iv, k_dst, is.first, face});
+                    }
+                }
+            }
+        }
+    }
+
+    // The order of the data in the messages
+    for (auto& kv : plan.snd_tags) std::sort(kv.second.begin(), kv.second.end());
+    for (auto& kv : plan.rcv_tags) std::sort(kv.second.begin(), kv.second.end());
+
+    return plan;
+}
+
 void 
 FluxRegister::Reflux (MultiFab&       mf,
 		      const MultiFab& volume,
@@ -446,32 +559,181 @@ FluxRegister::Reflux (MultiFab&       mf,
 {
     BL_PROFILE("FluxRegister::Reflux()");
 
-    for (OrientationIter fi; fi; ++fi)
+    const RefluxPlan& plan = getRefluxPlan(mf.boxArray(), mf.DistributionMap(),
+                                           geom.periodicity());
+
+    //
+    // A correction of the coarse cells in dbox with the fluxes in f at
+    // the nodes shifted by offset from the cells.
+    //
+    struct RefluxItem
     {
-	const Orientation& face = fi();
-	int idir = face.coordDir();
+        Array4<Real> f;
+        Box  dbox;
+        Dim3 offset;
+        int  fcomp;
+        Orientation face;
+    };
+    LayoutData<Vector<RefluxItem> > items(mf.boxArray(), mf.DistributionMap());
+
+    for (const auto& tag : plan.loc_tags)
+    {
+        const Orientation face = tag.face;
+        IntVect offset = -tag.shift;
+        if (face.isLow()) offset += IntVect::TheDimensionVector(face.coordDir());
+        items[tag.dstIndex].push_back({bndry[face][tag.srcIndex].array(), tag.dbox,
+                                       offset.dim3(), scomp, tag.face});
+    }
+
+#ifdef BL_USE_MPI
+    const int N_rcvs = plan.rcv_tags.size();
+    const int N_snds = plan.snd_tags.size();
+
+    char* the_recv_data = nullptr;
+    char* the_send_data = nullptr;
+    Vector<MPI_Request> recv_reqs, send_reqs;
+
+    if (N_rcvs > 0 || N_snds > 0)
+    {
+        const int seqno = ParallelDescriptor::SeqNum();
+        MPI_Comm comm = ParallelContext::CommunicatorSub();
+
+        //
+        // One message from each process with the registers of all faces.
+        //
+        Vector<std::size_t> recv_offset;
+        std::size_t recv_volume = 0;
+        for (const auto& kv : plan.rcv_tags) {
+            recv_offset.push_back(recv_volume);
+            for (const auto& tag : kv.second) {
+                recv_volume += tag.dbox.numPts() * nc * sizeof(Real);
+            }
+        }
+        recv_offset.push_back(recv_volume);
+        if (recv_volume > 0) {
+            the_recv_data = static_cast<char*>(amrex::The_FA_Arena()->alloc(recv_volume));
+        }
+
+        int i = 0;
+        for (const auto& kv : plan.rcv_tags) {
+            const std::size_t nbytes = recv_offset[i+1] - recv_offset[i];
+            if (nbytes > 0) {
+                BL_ASSERT(nbytes < std::numeric_limits<int>::max());
+                recv_reqs.push_back(ParallelDescriptor::Arecv
+                                    (the_recv_data+recv_offset[i], nbytes,
+                                     ParallelContext::global_to_local_rank(kv.first),
+                                     seqno, comm).req());
+            }
+            ++i;
+        }
 
-        MultiFab flux(amrex::convert(mf.boxArray(), IntVect::TheDimensionVector(idir)),
-                      mf.DistributionMap(), nc, 0, MFInfo(), mf.Factory());
-	flux.setVal(0.0);
+        Vector<std::size_t> send_offset;
+        std::size_t send_volume = 0;
+        for (const auto& kv : plan.snd_tags) {
+            send_offset.push_back(send_volume);
+            for (const auto& tag : kv.second) {
+                send_volume += tag.dbox.numPts() * nc * sizeof(Real);
+            }
+        }
+        send_offset.push_back(send_volume);
+        if (send_volume > 0) {
+            the_send_data = static_cast<char*>(amrex::The_FA_Arena()->alloc(send_volume));
+        }
 
-	bndry[face].copyTo(flux, 0, scomp, 0, nc, geom.periodicity());
+        Vector<const std::vector<RefluxTag>*> send_tags;
+        for (const auto& kv : plan.snd_tags) send_tags.push_back(&kv.second);
 
 #ifdef _OPENMP
+#pragma omp parallel for if (Gpu::notInLaunchRegion())
+#endif
+        for (int j = 0; j < N_snds; ++j)
+        {
+            char* dptr = the_send_data + send_offset[j];
+            for (const auto& tag : *send_tags[j])
+            {
+                const Orientation face = tag.face;
+                const Box& bx = RefluxNodes(tag.dbox,face) - tag.shift;
+                auto const sfab = bndry[face].array(tag.srcIndex);
+                auto pfab = amrex::makeArray4((Real*)(dptr), bx);
+                AMREX_HOST_DEVICE_FOR_4D ( bx, nc, ii, jj, kk, n,
+                {
+                    pfab(ii,jj,kk,n) = sfab(ii,jj,kk,scomp+n);
+                });
+                dptr += bx.numPts() * nc * sizeof(Real);
+            }
+        }
+
+        i = 0;
+        for (const auto& kv : plan.snd_tags) {
+            const std::size_t nbytes = send_offset[i+1] - send_offset[i];
+            if (nbytes > 0) {
+                BL_ASSERT(nbytes < std::numeric_limits<int>::max());
+                send_reqs.push_back(ParallelDescriptor::Asend
+                                    (the_send_data+send_offset[i], nbytes,
+                                     ParallelContext::global_to_local_rank(kv.first),
+                                     seqno, comm).req());
+            }
+            ++i;
+        }
+
+        if (!recv_reqs.empty()) {
+            Vector<MPI_Status> stats(recv_reqs.size());
+            ParallelDescriptor::Waitall(recv_reqs, stats);
+        }
+
+        i = 0;
+        for (const auto& kv : plan.rcv_tags) {
+            char* dptr = the_recv_data + recv_offset[i];
+            for (const auto& tag : kv.second)
+            {
+                const Orientation face = tag.face;
+                const Box& bx = RefluxNodes(tag.dbox,face);
+                IntVect offset = IntVect::TheZeroVector();
+                if (face.isLow()) offset = IntVect::TheDimensionVector(face.coordDir());
+                items[tag.dstIndex].push_back({amrex::makeArray4((Real*)(dptr), bx),
+                                               tag.dbox, offset.dim3(), 0, tag.face});
+                dptr += bx.numPts() * nc * sizeof(Real);
+            }
+            ++i;
+        }
+    }
+#endif
+
+    //
+    // The corrections of a coarse cell are added in the order of the faces.
+    //
+#ifdef _OPENMP
 #pragma omp parallel if (Gpu::notInLaunchRegion())
 #endif
-	for (MFIter mfi(mf,TilingIfNotGPU()); mfi.isValid(); ++mfi)
-	{
-	    const Box& bx = mfi.tilebox();
-            FArrayBox* sfab = mf.fabPtr(mfi);
-            FArrayBox const* ffab = flux.fabPtr(mfi);
-            FArrayBox const* vfab = volume.fabPtr(mfi);
-            AMREX_LAUNCH_HOST_DEVICE_LAMBDA (bx, tbx,
+    for (MFIter mfi(mf); mfi.isValid(); ++mfi)
+    {
+        Vector<RefluxItem>& fab_items = items[mfi];
+        std::stable_sort(fab_items.begin(), fab_items.end(),
+                         [] (const RefluxItem& a, const RefluxItem& b) { return int(a.face) < int(b.face); });
+
+        auto       sfab =     mf.array(mfi);
+        auto const vfab = volume.array(mfi);
+        for (const auto& item : fab_items)
+        {
+            const Real mult = item.face.isLow() ? -scale : scale;
+            const auto f = item.f;
+            const Dim3 o = item.offset;
+            const int fc = item.fcomp;
+            AMREX_HOST_DEVICE_FOR_4D ( item.dbox, nc, i, j, k, n,
             {
-                fluxreg_reflux(tbx, *sfab, dcomp, *ffab, *vfab, nc, scale, face);
+                sfab(i,j,k,dcomp+n) += mult*f(i+o.x,j+o.y,k+o.z,fc+n)/vfab(i,j,k);
             });
-	}
+        }
     }
+
+#ifdef BL_USE_MPI
+    if (!send_reqs.empty()) {
+        Vector<MPI_Status> stats(send_reqs.size());
+        ParallelDescriptor::Waitall(send_reqs, stats);
+    }
+    if (the_recv_data) amrex::The_FA_Arena()->free(the_recv_data);
+    if (the_send_data) amrex::The_FA_Arena()->free(the_send_data);
+#endif
 }
 
 void 
@@ -35,6 +35,91 @@ CellConservativeQuartic   quartic_interp;
 
 Interpolater::~Interpolater () {}
 
+namespace {
+
+//
+// The parts of the interpolations that work on fine cells, as templates on
+// the type of the refinement ratio.  They are called with StaticRatio<2> or
+// StaticRatio<4> if the ratio is 2 or 4 in all directions, and with the
+// IntVect otherwise.
+//
+
+template <class RT>
+void
+pcinterp_run (const Box& fine_region, FArrayBox* finep, int fine_comp, int ncomp,
+              FArrayBox const* crsep, int crse_comp, RT const& ratio)
+{
+    AMREX_LAUNCH_HOST_DEVICE_LAMBDA (fine_region, tbx,
+    {
+        amrex::pcinterp_interp(tbx,*finep,fine_comp,ncomp,*crsep,crse_comp,ratio);
+    });
+}
+
+template <class RT>
+void
+nodebilin_run (const Box& cslope_bx, const Box& fine_region, FArrayBox* finep, int fine_comp,
+               int ncomp, FArrayBox* slopefab, FArrayBox const* crsep, int crse_comp,
+               RT const& ratio)
+{
+    AMREX_LAUNCH_HOST_DEVICE_LAMBDA (cslope_bx, tbx,
+    {
+        amrex::nodebilin_slopes(tbx, *slopefab, *crsep, crse_comp, ncomp, ratio);
+    });
+
+    AMREX_LAUNCH_HOST_DEVICE_LAMBDA (fine_region, tbx,
+    {
+        amrex::nodebilin_interp(tbx, *finep, fine_comp, ncomp, *slopefab, *crsep, crse_comp, ratio);
+    });
+}
+
+template <class RT>
+void
+cellconslin_run (bool do_linear_limiting, const Box& cslope_bx, const Box& fine_region,
+                 FArrayBox* finep, int fine_comp, int ncomp, FArrayBox* ccfab,
+                 FArrayBox const* crsep, int crse_comp, BCRec const* bcrp,
+                 Real const* voff, RT const& ratio)
+{
+    if (do_linear_limiting) {
+        AMREX_LAUNCH_HOST_DEVICE_LAMBDA (cslope_bx, tbx,
+        {
+            amrex::cellconslin_slopes_linlim(tbx, *ccfab, *crsep, crse_comp, ncomp, bcrp);
+        });
+
+        AMREX_LAUNCH_HOST_DEVICE_LAMBDA (fine_region, tbx,
+        {
+            amrex::cellconslin_interp(tbx, *finep, fine_comp, ncomp, *ccfab, *crsep, crse_comp,
+                                      voff, ratio);
+        });
+    } else {
+        const Box& fslope_bx = amrex::refine(cslope_bx,IntVect(ratio));
+        AsyncFab as_fafab(fslope_bx, ncomp);
+        FArrayBox* fafab = as_fafab.fabPtr();
+
+        AMREX_LAUNCH_HOST_DEVICE_LAMBDA (cslope_bx, tbx,
+        {
+            amrex::cellconslin_slopes_mclim(tbx, *ccfab, *crsep, crse_comp, ncomp, bcrp);
+        });
+
+        AMREX_LAUNCH_HOST_DEVICE_LAMBDA (fslope_bx, tbx,
+        {
+            amrex::cellconslin_fine_alpha(tbx, *fafab, *ccfab, ncomp, voff, ratio);
+        });
+
+        AMREX_LAUNCH_HOST_DEVICE_LAMBDA (cslope_bx, tbx,
+        {
+            amrex::cellconslin_slopes_mmlim(tbx, *ccfab, *fafab, ncomp, ratio);
+        });
+
+        AMREX_LAUNCH_HOST_DEVICE_LAMBDA (fine_region, tbx,
+        {
+            amrex::cellconslin_interp(tbx, *finep, fine_comp, ncomp, *ccfab, *crsep, crse_comp,
+                                      voff, ratio);
+        });
+    }
+}
+
+}
+
 InterpolaterBoxCoarsener
 Interpolater::BoxCoarsener (const IntVect& ratio)
 {
@@ -121,15 +206,16 @@ NodeBilinear::interp (const FArrayBox&  crse,
     AsyncFab as_slopefab(cslope_bx, num_slope);
     FArrayBox* slopefab = as_slopefab.fabPtr();
 
-    AMREX_LAUNCH_HOST_DEVICE_LAMBDA (cslope_bx, tbx,
-    {
-        amrex::nodebilin_slopes(tbx, *slopefab, *crsep, crse_comp, ncomp, ratio);
-    });
-
-    AMREX_LAUNCH_HOST_DEVICE_LAMBDA (fine_region, tbx,
-    {
-        amrex::nodebilin_interp(tbx, *finep, fine_comp, ncomp, *slopefab, *crsep, crse_comp, ratio);
-    });
+    if (ratio == 2) {
+        nodebilin_run(cslope_bx, fine_region, finep, fine_comp, ncomp, slopefab, crsep, crse_comp,
+                      StaticRatio<2>());
+    } else if (ratio == 4) {
+        nodebilin_run(cslope_bx, fine_region, finep, fine_comp, ncomp, slopefab, crsep, crse_comp,
+                      StaticRatio<4>());
+    } else {
+        nodebilin_run(cslope_bx, fine_region, finep, fine_comp, ncomp, slopefab, crsep, crse_comp,
+                      ratio);
+    }
 }
 
 CellBilinear::~CellBilinear () {}
@@ -307,42 +393,15 @@ CellConservativeLinear::interp (const FArrayBox& crse,
     AsyncArray<Real> async_voff(vec_voff.data(), vec_voff.size());
     Real const* voff = async_voff.data();
 
-    if (do_linear_limiting) {
-        AMREX_LAUNCH_HOST_DEVICE_LAMBDA (cslope_bx, tbx,
-        {
-            amrex::cellconslin_slopes_linlim(tbx, *ccfab, *crsep, crse_comp, ncomp, bcrp);
-        });
-
-        AMREX_LAUNCH_HOST_DEVICE_LAMBDA (fine_region, tbx,
-        {
-            amrex::cellconslin_interp(tbx, *finep, fine_comp, ncomp, *ccfab, *crsep, crse_comp,
-                                      voff, ratio);
-        });
+    if (ratio == 2) {
+        cellconslin_run(do_linear_limiting, cslope_bx, fine_region, finep, fine_comp, ncomp,
+                        ccfab, crsep, crse_comp, bcrp, voff, StaticRatio<2>());
+    } else if (ratio == 4) {
+        cellconslin_run(do_linear_limiting, cslope_bx, fine_region, finep, fine_comp, ncomp,
+                        ccfab, crsep, crse_comp, bcrp, voff, StaticRatio<4>());
     } else {
-        const Box& fslope_bx = amrex::refine(cslope_bx,ratio);
-        AsyncFab as_fafab(fslope_bx, ncomp);
-        FArrayBox* fafab = as_fafab.fabPtr();
-
-        AMREX_LAUNCH_HOST_DEVICE_LAMBDA (cslope_bx, tbx,
-        {
-            amrex::cellconslin_slopes_mclim(tbx, *ccfab, *crsep, crse_comp, ncomp, bcrp);
-        });
-
-        AMREX_LAUNCH_HOST_DEVICE_LAMBDA (fslope_bx, tbx,
-        {
-            amrex::cellconslin_fine_alpha(tbx, *fafab, *ccfab, ncomp, voff, ratio);
-        });
-
-        AMREX_LAUNCH_HOST_DEVICE_LAMBDA (cslope_bx, tbx,
-        {
-            amrex::cellconslin_slopes_mmlim(tbx, *ccfab, *fafab, ncomp, ratio);
-        });
-
-        AMREX_LAUNCH_HOST_DEVICE_LAMBDA (fine_region, tbx,
-        {
-            amrex::cellconslin_interp(tbx, *finep, fine_comp, ncomp, *ccfab, *crsep, crse_comp,
-                                      voff, ratio);
-        });
+        cellconslin_run(do_linear_limiting, cslope_bx, fine_region, finep, fine_comp, ncomp,
+                        ccfab, crsep, crse_comp, bcrp, voff, ratio);
     }
 }
 
@@ -509,10 +568,13 @@ PCInterp::interp (const FArrayBox& crse,
 
     Gpu::LaunchSafeGuard lg(Gpu::isDevicePtr(crsep) && Gpu::isDevicePtr(finep));
 
-    AMREX_LAUNCH_HOST_DEVICE_LAMBDA (fine_region, tbx,
-    {
-        amrex::pcinterp_interp(tbx,*finep,fine_comp,ncomp,*crsep,crse_comp,ratio);
-    });
+    if (ratio == 2) {
+        pcinterp_run(fine_region, finep, fine_comp, ncomp, crsep, crse_comp, StaticRatio<2>());
+    } else if (ratio == 4) {
+        pcinterp_run(fine_region, finep, fine_comp, ncomp, crsep, crse_comp, StaticRatio<4>());
+    } else {
+        pcinterp_run(fine_region, finep, fine_comp, ncomp, crsep, crse_comp, ratio);
+    }
 }
 
 CellConservativeProtected::CellConservativeProtected () {}
@@ -584,16 +646,16 @@ CellConservativeProtected::interp (const FArrayBox& crse,
     AsyncArray<Real> async_voff(vec_voff.data(), vec_voff.size());
     Real const* voff = async_voff.data();
 
-    AMREX_LAUNCH_HOST_DEVICE_LAMBDA (cslope_bx, tbx,
-    {
-        amrex::cellconslin_slopes_linlim(tbx, *ccfab, *crsep, crse_comp, ncomp, bcrp);
-    });
-
-    AMREX_LAUNCH_HOST_DEVICE_LAMBDA (fine_region, tbx,
-    {
-        amrex::cellconslin_interp(tbx, *finep, fine_comp, ncomp, *ccfab, *crsep, crse_comp,
-                                  voff, ratio);
-    });
+    if (ratio == 2) {
+        cellconslin_run(true, cslope_bx, fine_region, finep, fine_comp, ncomp,
+                        ccfab, crsep, crse_comp, bcrp, voff, StaticRatio<2>());
+    } else if (ratio == 4) {
+        cellconslin_run(true, cslope_bx, fine_region, finep, fine_comp, ncomp,
+                        ccfab, crsep, crse_comp, bcrp, voff, StaticRatio<4>());
+    } else {
+        cellconslin_run(true, cslope_bx, fine_region, finep, fine_comp, ncomp,
+                        ccfab, crsep, crse_comp, bcrp, voff, ratio);
+    }
 }
 
 void
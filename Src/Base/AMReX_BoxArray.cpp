@@ -1,7 +1,11 @@
 
+#include <algorithm>
+#include <numeric>
+
 #include <AMReX_BLassert.H>
 #include <AMReX_BoxArray.H>
 #include <AMReX_ParallelDescriptor.H>
+#include <AMReX_ParmParse.H>
 #include <AMReX_Utility.H>
 #include <AMReX_MFIter.H>
 #include <AMReX_BaseFab.H>
@@ -28,6 +32,9 @@ long BARef::total_hash_bytes_hwm = 0L;
 bool    BARef::initialized = false;
 bool BoxArray::initialized = false;
 
+int  BARef::use_box_tree   = -1;
+Real BARef::box_tree_ratio = 16.0;
+
 namespace {
     const int bl_ignore_max = 100000;
 }
@@ -182,6 +189,9 @@ BARef::resize (long n) {
     m_abox.resize(n);
     hash.clear();
     has_hashmap = false;
+    tree.clear();
+    tree_index.clear();
+    has_tree = false;
 #ifdef BL_MEM_PROFILING
     updateMemoryUsage_box(1);
 #endif
@@ -208,12 +218,18 @@ BARef::updateMemoryUsage_box (int s)
 void
 BARef::updateMemoryUsage_hash (int s)
 {
+    long b = 0;
     if (hash.size() > 0) {
-	long b = sizeof(hash);
+	b += sizeof(hash);
 	for (const auto& x: hash) {
 	    b += amrex::gcc_map_node_extra_bytes
 		+ sizeof(IntVect) + amrex::bytesOf(x.second);
 	}
+    }
+    if (tree.size() > 0) {
+        b += amrex::bytesOf(tree) + amrex::bytesOf(tree_index);
+    }
+    if (b > 0) {
 	if (s > 0) {
 	    total_hash_bytes += b;
 	    total_hash_bytes_hwm = std::max(total_hash_bytes_hwm, total_hash_bytes);
@@ -243,6 +259,9 @@ BARef::Initialize ()
 			     return {numboxarrays, numboxarrays_hwm};
 			 }));
 #endif
+        ParmParse pp("boxarray");
+        pp.query("use_box_tree", use_box_tree);
+        pp.query("box_tree_ratio", box_tree_ratio);
     }
 
     amrex::ExecOnFinalize(BARef::Finalize);
@@ -1094,10 +1113,47 @@ BoxArray::intersections (const Box&                         bx,
 {
   // This is called too many times BL_PROFILE("BoxArray::intersections()");
 
-    BARef::HashType& BoxHashMap = getHashMap();
-
     isects.resize(0);
 
+    if (empty()) return;
+
+    if (useBoxTree())
+    {
+        BL_ASSERT(bx.ixType() == ixType());
+
+	Box gbx = amrex::grow(bx,ng);
+
+	IntVect glo = gbx.smallEnd();
+	IntVect ghi = gbx.bigEnd();
+	const IntVect& doilo = getDoiLo();
+	const IntVect& doihi = getDoiHi();
+
+	gbx.setSmall(glo - doihi).setBig(ghi + doilo);
+        gbx.refine(m_crse_ratio);
+
+        const Box cbx(gbx.smallEnd(), gbx.bigEnd());
+
+        bool super_simple = m_simple && m_crse_ratio==1 && m_typ.cellCentered();
+        auto& abox = m_ref->m_abox;
+
+        m_ref->forEachTreeBox(cbx, [&] (int index) -> bool
+        {
+            const Box& ibox = super_simple ? abox[index] : (*this)[index];
+            const Box& isect = bx & amrex::grow(ibox,ng);
+
+            if (isect.ok())
+            {
+                isects.push_back(std::pair<int,Box>(index,isect));
+                return first_only;
+            }
+            return false;
+        });
+
+        return;
+    }
+
+    BARef::HashType& BoxHashMap = getHashMap();
+
     if (!BoxHashMap.empty())
     {
         BL_ASSERT(bx.ixType() == ixType());
@@ -1162,7 +1218,48 @@ BoxArray::complementIn (BoxList& bl, const Box& bx) const
     bl.set(bx.ixType());
     bl.push_back(bx);
 
-    if (!empty()) 
+    if (!empty() && useBoxTree())
+    {
+	BL_ASSERT(bx.ixType() == ixType());
+
+	Box gbx = bx;
+
+	IntVect glo = gbx.smallEnd();
+	IntVect ghi = gbx.bigEnd();
+	const IntVect& doilo = getDoiLo();
+	const IntVect& doihi = getDoiHi();
+
+	gbx.setSmall(glo - doihi).setBig(ghi + doilo);
+        gbx.refine(m_crse_ratio);
+
+        const Box cbx(gbx.smallEnd(), gbx.bigEnd());
+
+        BoxList newbl(bl.ixType());
+        newbl.reserve(bl.capacity());
+        BoxList newdiff(bl.ixType());
+
+        bool super_simple = m_simple && m_crse_ratio==1 && m_typ.cellCentered();
+        auto& abox = m_ref->m_abox;
+
+        m_ref->forEachTreeBox(cbx, [&] (int index) -> bool
+        {
+            const Box& isect = (super_simple)
+                ? (bx & abox[index])
+                : (bx & (*this)[index]);
+
+            if (isect.ok())
+            {
+                newbl.clear();
+                for (const Box& b : bl) {
+                    amrex::boxDiff(newdiff, b, isect);
+                    newbl.join(newdiff);
+                }
+                bl.swap(newbl);
+            }
+            return bl.isEmpty();
+        });
+    }
+    else if (!empty()) 
     {
 	BARef::HashType& BoxHashMap = getHashMap();
 
@@ -1227,13 +1324,16 @@ BoxArray::complementIn (BoxList& bl, const Box& bx) const
 void
 BoxArray::clear_hash_bin () const
 {
-    if (!m_ref->hash.empty())
+    if (!m_ref->hash.empty() || !m_ref->tree.empty())
     {
 #ifdef BL_MEM_PROFILING
 	m_ref->updateMemoryUsage_hash(-1);
 #endif
         m_ref->hash.clear();
         m_ref->has_hashmap = false;
+        m_ref->tree.clear();
+        m_ref->tree_index.clear();
+        m_ref->has_tree = false;
     }
 }
 
@@ -1253,6 +1353,13 @@ BoxArray::removeOverlap (bool simplify)
 
     uniqify();
 
+    //
+    // The loop below adds boxes to the hash as it goes.  The box tree
+    // cannot be updated that way.
+    //
+    if (m_ref->HasBoxTree()) clear_hash_bin();
+    getHashMap();
+
     BARef::HashType& BoxHashMap = m_ref->hash;
 
     const Box EmptyBox;
@@ -1398,6 +1505,140 @@ BoxArray::getHashMap () const
     return BoxHashMap;
 }
 
+bool
+BoxArray::useBoxTree () const
+{
+    if (m_ref->HasHashMap()) return false;
+    if (m_ref->HasBoxTree()) return true;
+
+    bool use_tree = false;
+
+#ifdef _OPENMP
+    #pragma omp critical(intersections_lock)
+#endif
+    {
+        if (m_ref->tree.empty() && m_ref->hash.empty() && size() > 0)
+        {
+            if (BARef::use_box_tree < 0)
+            {
+                //
+                // The hash bins are as large as the largest box.  This is
+                // the average number of boxes per bin if the boxes cover
+                // their bounding box.
+                //
+                IntVect maxext = IntVect::TheUnitVector();
+                double npts = 0.0;
+                for (const Box& bx : m_ref->m_abox) {
+                    maxext = amrex::max(maxext, bx.size());
+                    npts += bx.d_numPts();
+                }
+                double boxes_per_bin = AMREX_D_TERM(double(maxext[0]),*maxext[1],*maxext[2])
+                    * size() / npts;
+                use_tree = boxes_per_bin > BARef::box_tree_ratio;
+            }
+            else
+            {
+                use_tree = BARef::use_box_tree > 0;
+            }
+
+            if (use_tree)
+            {
+                m_ref->buildBoxTree();
+#ifdef BL_MEM_PROFILING
+                m_ref->updateMemoryUsage_hash(1);
+#endif
+#ifdef _OPENMP
+#pragma omp atomic write
+#endif
+                m_ref->has_tree = true;
+            }
+        }
+        else
+        {
+            use_tree = !m_ref->tree.empty();
+        }
+    }
+
+    if (!use_tree) getHashMap();
+
+    return use_tree;
+}
+
+void
+BARef::buildBoxTree () const
+{
+    const int N = m_abox.size();
+    tree_index.resize(N);
+    std::iota(tree_index.begin(), tree_index.end(), 0);
+    tree.clear();
+    tree.reserve(N/2+1);
+    buildTreeNode(0, N);
+}
+
+int
+BARef::buildTreeNode (int begin, int end) const
+{
+    const int inode = tree.size();
+    tree.push_back(TreeNode());
+
+    Box bx = m_abox[tree_index[begin]];
+    for (int k = begin+1; k < end; ++k) {
+        bx.minBox(m_abox[tree_index[k]]);
+    }
+
+    int right = -1;
+    if (end - begin > 4)
+    {
+        //
+        // Split at the median of the box centers in the longest direction.
+        //
+        int dir;
+        bx.longside(dir);
+        const int mid = (begin + end) / 2;
+        const auto& abox = m_abox;
+        std::nth_element(tree_index.begin()+begin, tree_index.begin()+mid, tree_index.begin()+end,
+                         [&abox,dir] (int a, int b) -> bool {
+                             const int ca = abox[a].smallEnd(dir) + abox[a].bigEnd(dir);
+                             const int cb = abox[b].smallEnd(dir) + abox[b].bigEnd(dir);
+                             return ca < cb || (ca == cb && a < b);
+                         });
+        buildTreeNode(begin, mid);
+        right = buildTreeNode(mid, end);
+    }
+
+    tree[inode] = TreeNode{bx, begin, end, right};
+    return inode;
+}
+
+template <class F>
+void
+BARef::forEachTreeBox (const Box& bx, F&& f) const
+{
+    if (tree.empty() || !tree[0].bx.intersects(bx)) return;
+
+    // The depth of the tree is about log2(size()/4)
+    int stack[64];
+    int top = 0;
+    stack[top++] = 0;
+    while (top > 0)
+    {
+        const int inode = stack[--top];
+        const TreeNode& node = tree[inode];
+        if (node.right < 0)
+        {
+            for (int k = node.begin; k < node.end; ++k) {
+                const int i = tree_index[k];
+                if (m_abox[i].intersects(bx) && f(i)) return;
+            }
+        }
+        else
+        {
+            if (tree[node.right].bx.intersects(bx)) stack[top++] = node.right;
+            if (tree[inode+1].bx.intersects(bx)) stack[top++] = inode+1;
+        }
+    }
+}
+
 void
 BoxArray::uniqify ()
 {
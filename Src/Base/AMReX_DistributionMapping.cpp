@@ -1367,6 +1367,58 @@ DistributionMapping::makeKnapSack (const Vector<Real>& rcost)
     return r;
 }
 
+DistributionMapping
+DistributionMapping::makeIncremental (const BoxArray& ba, const BoxArray& old_ba,
+                                      const DistributionMapping& old_dm)
+{
+    BL_PROFILE("makeIncremental");
+
+    const int nprocs = ParallelContext::NProcsSub();
+    const int N = ba.size();
+
+    Vector<int> pmap(N, -1);
+    std::vector<long> load(nprocs, 0L);
+    std::vector<LIpair> new_boxes;
+
+    std::vector< std::pair<int,Box> > isects;
+    for (int i = 0; i < N; ++i)
+    {
+        const Box& bx = ba[i];
+        int owner = -1;
+        old_ba.intersections(bx, isects);
+        for (const auto& is : isects) {
+            if (old_ba[is.first] == bx) {
+                owner = ParallelContext::global_to_local_rank(old_dm[is.first]);
+                break;
+            }
+        }
+        if (owner >= 0 && owner < nprocs) {
+            pmap[i] = ParallelContext::local_to_global_rank(owner);
+            load[owner] += bx.numPts();
+        } else {
+            new_boxes.push_back(LIpair(bx.numPts(), i));
+        }
+    }
+
+    Sort(new_boxes, true);
+
+    std::priority_queue<LIpair,std::vector<LIpair>,LIpairGT> procs;
+    for (int i = 0; i < nprocs; ++i) {
+        procs.push(LIpair(load[i], i));
+    }
+
+    for (const auto& b : new_boxes)
+    {
+        LIpair p = procs.top();
+        procs.pop();
+        pmap[b.second] = ParallelContext::local_to_global_rank(p.second);
+        p.first += b.first;
+        procs.push(p);
+    }
+
+    return DistributionMapping(std::move(pmap));
+}
+
 DistributionMapping
 DistributionMapping::makeKnapSack (const MultiFab& weight, int nmax)
 {
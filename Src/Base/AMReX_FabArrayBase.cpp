@@ -1060,6 +1060,17 @@ FabArrayBase::getFB (const IntVect& nghost, const Periodicity& period,
     return *new_fb;
 }
 
+struct FabArrayBase::BDHolder
+    : public FabArrayBase
+{
+    BDHolder (const BoxArray& ba, const DistributionMapping& dm)
+    {
+        define(ba, dm, 1, 0);
+        addThisBD();
+    }
+    ~BDHolder () { clearThisBD(); }
+};
+
 FabArrayBase::FPinfo::FPinfo (const FabArrayBase& srcfa,
 			      const FabArrayBase& dstfa,
 			      const Box&          dstdomain,
@@ -1114,6 +1125,7 @@ FabArrayBase::FPinfo::FPinfo (const FabArrayBase& srcfa,
     if (!iprocs.empty()) {
 	ba_crse_patch.define(bl);
 	dm_crse_patch.define(std::move(iprocs));
+        bd_crse_patch.reset(new BDHolder(ba_crse_patch, dm_crse_patch));
 #ifdef AMREX_USE_EB
         fact_crse_patch = makeEBFabFactory(Geometry(cdomain),
                                            ba_crse_patch,
@@ -1398,6 +1410,12 @@ FabArrayBase::Finalize ()
     initialized = false;
 }
 
+long
+FabArrayBase::bytesSent ()
+{
+    return m_FA_stats.num_bytes_sent;
+}
+
 const FabArrayBase::TileArray* 
 FabArrayBase::getTileArray (const IntVect& tilesize) const
 {
@@ -18,7 +18,8 @@ MFIter::MFIter (const FabArrayBase& fabarray_,
     local_index_map(nullptr),
     tile_array(nullptr),
     local_tile_index_map(nullptr),
-    num_local_tiles(nullptr)
+    num_local_tiles(nullptr),
+    tile_subset(nullptr)
 {
     Initialize();
 }
@@ -34,7 +35,8 @@ MFIter::MFIter (const FabArrayBase& fabarray_,
     local_index_map(nullptr),
     tile_array(nullptr),
     local_tile_index_map(nullptr),
-    num_local_tiles(nullptr)
+    num_local_tiles(nullptr),
+    tile_subset(nullptr)
 {
     Initialize();
 }
@@ -51,7 +53,8 @@ MFIter::MFIter (const FabArrayBase& fabarray_,
     local_index_map(nullptr),
     tile_array(nullptr),
     local_tile_index_map(nullptr),
-    num_local_tiles(nullptr)
+    num_local_tiles(nullptr),
+    tile_subset(nullptr)
 {
     Initialize();
 }
@@ -69,7 +72,8 @@ MFIter::MFIter (const BoxArray& ba, const DistributionMapping& dm, unsigned char
     local_index_map(nullptr),
     tile_array(nullptr),
     local_tile_index_map(nullptr),
-    num_local_tiles(nullptr)
+    num_local_tiles(nullptr),
+    tile_subset(nullptr)
 {
     Initialize();
 }
@@ -87,7 +91,8 @@ MFIter::MFIter (const BoxArray& ba, const DistributionMapping& dm, bool do_tilin
     local_index_map(nullptr),
     tile_array(nullptr),
     local_tile_index_map(nullptr),
-    num_local_tiles(nullptr)
+    num_local_tiles(nullptr),
+    tile_subset(nullptr)
 {
     Initialize();
 }
@@ -107,7 +112,8 @@ MFIter::MFIter (const BoxArray& ba, const DistributionMapping& dm,
     local_index_map(nullptr),
     tile_array(nullptr),
     local_tile_index_map(nullptr),
-    num_local_tiles(nullptr)
+    num_local_tiles(nullptr),
+    tile_subset(nullptr)
 {
     Initialize();
 }
@@ -126,7 +132,8 @@ MFIter::MFIter (const BoxArray& ba, const DistributionMapping& dm, const MFItInf
     local_index_map(nullptr),
     tile_array(nullptr),
     local_tile_index_map(nullptr),
-    num_local_tiles(nullptr)
+    num_local_tiles(nullptr),
+    tile_subset(info.tiles)
 {
     if (dynamic) {
 #ifdef _OPENMP
@@ -152,7 +159,8 @@ MFIter::MFIter (const FabArrayBase& fabarray_, const MFItInfo& info)
     local_index_map(nullptr),
     tile_array(nullptr),
     local_tile_index_map(nullptr),
-    num_local_tiles(nullptr)
+    num_local_tiles(nullptr),
+    tile_subset(info.tiles)
 {
     if (dynamic) {
 #ifdef _OPENMP
@@ -212,7 +220,8 @@ MFIter::Initialize ()
     }
     else
     {
-	const FabArrayBase::TileArray* pta = fabArray.getTileArray(tile_size);
+	const FabArrayBase::TileArray* pta = (tile_subset) ? tile_subset
+                                                           : fabArray.getTileArray(tile_size);
 	
 	index_map            = &(pta->indexMap);
 	local_index_map      = &(pta->localIndexMap);
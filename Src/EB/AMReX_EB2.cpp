@@ -7,23 +7,50 @@
 #include <AMReX_EB2_IF_Sphere.H>
 #include <AMReX_EB2_IF_Torus.H>
 #include <AMReX_EB2_IF_Spline.H>
+#include <AMReX_EB2_IF_STL.H>
 #include <AMReX_EB2_GeometryShop.H>
 #include <AMReX_EB2.H>
 #include <AMReX_ParmParse.H>
 #include <AMReX.H>
 
+#include <iomanip>
+#include <sstream>
+
 namespace amrex { namespace EB2 {
 
 Vector<std::unique_ptr<IndexSpace> > IndexSpace::m_instance;
 
 int max_grid_size = 64;
 bool compare_with_ch_eb = false;
+bool sparse_cut_data = false;
+std::string cache_dir;
+std::string cache_key;
+
+// Relative costs of a cell for load balancing.  Boxes with cut cells run
+// the EB kernels on all of their cells, and cut cells cost much more than
+// the others.
+bool load_balance = false;
+Real lb_cost_regular = 1.0;  // cell in a box without cut cells
+Real lb_cost_covered = 0.1;  // covered cell in a box without cut cells
+Real lb_cost_mixed = 2.0;    // regular or covered cell in a box with cut cells
+Real lb_cost_cut = 27.0;     // cut cell
+
+bool lazy_coarsening = true;
 
 void Initialize ()
 {
     ParmParse pp("eb2");
     pp.query("max_grid_size", max_grid_size);
     pp.query("compare_with_ch_eb", compare_with_ch_eb);
+    pp.query("sparse_cut_data", sparse_cut_data);
+    pp.query("cache_dir", cache_dir);
+    pp.query("cache_key", cache_key);
+    pp.query("load_balance", load_balance);
+    pp.query("lb_cost_regular", lb_cost_regular);
+    pp.query("lb_cost_covered", lb_cost_covered);
+    pp.query("lb_cost_mixed", lb_cost_mixed);
+    pp.query("lb_cost_cut", lb_cost_cut);
+    pp.query("lazy_coarsening", lazy_coarsening);
 
     amrex::ExecOnFinalize(Finalize);
 }
@@ -33,6 +60,39 @@ void Finalize ()
     IndexSpace::clear();
 }
 
+std::string
+cacheName (uint64_t if_hash, const std::string& if_type, const Geometry& geom,
+           int required_coarsening_level, int max_coarsening_level, int ngrow)
+{
+    uint64_t h = if_hash;
+    amrex::hash_combine(h, if_type);
+    amrex::hash_combine(h, cache_key);
+    std::ostringstream os;
+    os << std::setprecision(17) << geom.Domain() << " " << geom.ProbDomain()
+       << " " << geom.Coord();
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        os << " " << geom.isPeriodic(idim);
+    }
+    os << " " << required_coarsening_level << " " << max_coarsening_level
+       << " " << ngrow << " " << max_grid_size;
+    amrex::hash_combine(h, os.str());
+
+    std::ostringstream name;
+    name << cache_dir << "/eb2_" << std::hex << std::setw(16) << std::setfill('0') << h;
+    return name.str();
+}
+
+bool
+cacheExists (const std::string& cache_name)
+{
+    int exists = 0;
+    if (ParallelDescriptor::IOProcessor()) {
+        exists = amrex::FileExists(cache_name + "/Header");
+    }
+    ParallelDescriptor::Bcast(&exists, 1, ParallelDescriptor::IOProcessorNumber());
+    return exists;
+}
+
 void
 Build (const Geometry& geom, int required_coarsening_level,
        int max_coarsening_level, int ngrow)
@@ -140,6 +200,31 @@ Build (const Geometry& geom, int required_coarsening_level,
         EB2::Build(gshop, geom, required_coarsening_level,
                    max_coarsening_level, ngrow);
     }
+#if (AMREX_SPACEDIM == 3)
+    else if (geom_type == "stl")
+    {
+        std::string stl_file;
+        pp.get("stl_file", stl_file);
+
+        Real scale = 1.0;
+        pp.query("stl_scale", scale);
+
+        RealArray center{0.0, 0.0, 0.0};
+        pp.query("stl_center", center);
+
+        bool has_fluid_inside = false;
+        pp.query("stl_has_fluid_inside", has_fluid_inside);
+
+        Real max_distance = -1.0;
+        pp.query("stl_max_distance", max_distance);
+
+        EB2::STLIF sf(stl_file, scale, center, has_fluid_inside, max_distance);
+
+        EB2::GeometryShop<EB2::STLIF> gshop(sf);
+        EB2::Build(gshop, geom, required_coarsening_level,
+                   max_coarsening_level, ngrow);
+    }
+#endif
     else
     {
         amrex::Abort("geom_type "+geom_type+ " not supported");
@@ -160,18 +245,18 @@ static int comp_max_crse_level (Box cdomain, const Box& domain)
 }
 
 int
-maxCoarseningLevel (const Geometry& geom)
+maxCoarseningLevel (const Geometry& geom, int max_level)
 {
     const Box& domain = amrex::enclosedCells(geom.Domain());
-    const Box& cdomain = IndexSpace::top().coarsestDomain();
+    const Box& cdomain = IndexSpace::top().coarsestDomain(domain, max_level);
     return comp_max_crse_level(cdomain, domain);
 }
 
 int
-maxCoarseningLevel (IndexSpace const* ebis, const Geometry& geom)
+maxCoarseningLevel (IndexSpace const* ebis, const Geometry& geom, int max_level)
 {
     const Box& domain = amrex::enclosedCells(geom.Domain());
-    const Box& cdomain = ebis->coarsestDomain();
+    const Box& cdomain = ebis->coarsestDomain(domain, max_level);
     return comp_max_crse_level(cdomain,domain);
 }
 
@@ -0,0 +1,489 @@
+
+#include <AMReX_EB2_IF_CSG.H>
+#include <AMReX_Utility.H>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace amrex { namespace EB2 {
+
+namespace {
+
+    // Tiles no longer than this are evaluated with one pruned program
+    constexpr int csg_tile_size = 8;
+
+    // Stack depth that is kept on the stack of the caller
+    constexpr int csg_small_stack = 64;
+
+    template <class F>
+    IFBounds doPrimBounds (F const& f, const RealArray& lo, const RealArray& hi, std::true_type)
+    {
+        return f.bounds(lo, hi);
+    }
+
+    template <class F>
+    IFBounds doPrimBounds (F const&, const RealArray&, const RealArray&, std::false_type)
+    {
+        const Real big = std::numeric_limits<Real>::max();
+        return {-big, big};
+    }
+
+    template <class F>
+    IFBounds primBoundsT (F const& f, const RealArray& lo, const RealArray& hi)
+    {
+        return doPrimBounds(f, lo, hi, HasIFBounds<F>());
+    }
+
+    // Values of f at the nodes of bx, stored in the Fortran order of bx
+    template <class F, class X>
+    void evalPrim (F const& f, X const& xf, const Box& bx,
+                   const RealArray& problo, const RealArray& dx, Real* AMREX_RESTRICT out)
+    {
+        const auto lo  = amrex::lbound(bx);
+        const auto len = amrex::length(bx);
+        int n = 0;
+        for     (int k = 0; k < len.z; ++k) {
+            for (int j = 0; j < len.y; ++j) {
+                AMREX_PRAGMA_SIMD
+                for (int i = 0; i < len.x; ++i) {
+                    RealArray p {AMREX_D_DECL(problo[0]+(i+lo.x)*dx[0],
+                                              problo[1]+(j+lo.y)*dx[1],
+                                              problo[2]+(k+lo.z)*dx[2])};
+                    out[n+i] = f(xf(p));
+                }
+                n += len.x;
+            }
+        }
+    }
+}
+
+CSGIF::Xform::Xform ()
+    : shift_only(true)
+{
+    for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+        for (int j = 0; j < AMREX_SPACEDIM; ++j) {
+            a[i][j] = (i == j) ? 1.0 : 0.0;
+        }
+        b[i] = 0.0;
+    }
+}
+
+RealArray
+CSGIF::Xform::operator() (const RealArray& p) const
+{
+    RealArray q;
+    if (shift_only) {
+        for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+            q[i] = p[i] + b[i];
+        }
+    } else {
+        for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+            q[i] = b[i];
+            for (int j = 0; j < AMREX_SPACEDIM; ++j) {
+                q[i] += a[i][j]*p[j];
+            }
+        }
+    }
+    return q;
+}
+
+void
+CSGIF::Xform::map (const RealArray& lo, const RealArray& hi, RealArray& mlo, RealArray& mhi) const
+{
+    RealArray c, h;
+    for (int j = 0; j < AMREX_SPACEDIM; ++j) {
+        c[j] = 0.5*(lo[j]+hi[j]);
+        h[j] = 0.5*(hi[j]-lo[j]);
+    }
+    const RealArray mc = (*this)(c);
+    for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+        Real mh = 0.0;
+        for (int j = 0; j < AMREX_SPACEDIM; ++j) {
+            mh += std::abs(a[i][j])*h[j];
+        }
+        if (shift_only) {
+            mlo[i] = lo[i] + b[i];
+            mhi[i] = hi[i] + b[i];
+        } else {
+            mlo[i] = mc[i] - mh;
+            mhi[i] = mc[i] + mh;
+        }
+    }
+}
+
+CSGIF::Xform
+CSGIF::Xform::translate (const RealArray& offset) const
+{
+    Xform r = *this;
+    for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+        r.b[i] -= offset[i];
+    }
+    return r;
+}
+
+CSGIF::Xform
+CSGIF::Xform::scale (const RealArray& sfinv) const
+{
+    Xform r = *this;
+    r.shift_only = false;
+    for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+        for (int j = 0; j < AMREX_SPACEDIM; ++j) {
+            r.a[i][j] *= sfinv[i];
+        }
+        r.b[i] *= sfinv[i];
+    }
+    return r;
+}
+
+CSGIF::Xform
+CSGIF::Xform::rotate (Real angle, int dir) const
+{
+    // The same rotation as RotationIF
+    const Real c = std::cos(angle);
+    const Real s = std::sin(angle);
+    Array<RealArray,AMREX_SPACEDIM> m;
+    for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+        for (int j = 0; j < AMREX_SPACEDIM; ++j) {
+            m[i][j] = (i == j) ? 1.0 : 0.0;
+        }
+    }
+#if (AMREX_SPACEDIM == 2)
+    amrex::ignore_unused(dir);
+    m[0][0] =  c;  m[0][1] = s;
+    m[1][0] = -s;  m[1][1] = c;
+#elif (AMREX_SPACEDIM == 3)
+    if (dir == 0) {
+        m[1][1] =  c;  m[1][2] = s;
+        m[2][1] = -s;  m[2][2] = c;
+    } else if (dir == 1) {
+        m[0][0] = c;  m[0][2] = -s;
+        m[2][0] = s;  m[2][2] =  c;
+    } else {
+        m[0][0] =  c;  m[0][1] = s;
+        m[1][0] = -s;  m[1][1] = c;
+    }
+#endif
+
+    Xform r;
+    r.shift_only = false;
+    for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+        r.b[i] = 0.0;
+        for (int j = 0; j < AMREX_SPACEDIM; ++j) {
+            r.a[i][j] = 0.0;
+            for (int k = 0; k < AMREX_SPACEDIM; ++k) {
+                r.a[i][j] += m[i][k]*a[k][j];
+            }
+            r.b[i] += m[i][j]*b[j];
+        }
+    }
+    return r;
+}
+
+void
+CSGIF::addPrim (PrimType type, int index, const Xform& xf)
+{
+    m_prims.push_back(Prim{type, index, xf});
+    m_prog.push_back(Inst{op_prim, static_cast<int>(m_prims.size())-1});
+}
+
+void
+CSGIF::add (SphereIF const& f, const Xform& xf)
+{
+    m_spheres.push_back(f);
+    addPrim(sphere, m_spheres.size()-1, xf);
+}
+
+void
+CSGIF::add (EllipsoidIF const& f, const Xform& xf)
+{
+    m_ellipsoids.push_back(f);
+    addPrim(ellipsoid, m_ellipsoids.size()-1, xf);
+}
+
+void
+CSGIF::add (BoxIF const& f, const Xform& xf)
+{
+    m_boxes.push_back(f);
+    addPrim(box, m_boxes.size()-1, xf);
+}
+
+void
+CSGIF::add (PlaneIF const& f, const Xform& xf)
+{
+    m_planes.push_back(f);
+    addPrim(plane, m_planes.size()-1, xf);
+}
+
+void
+CSGIF::add (CylinderIF const& f, const Xform& xf)
+{
+    m_cylinders.push_back(f);
+    addPrim(cylinder, m_cylinders.size()-1, xf);
+}
+
+void
+CSGIF::finalize ()
+{
+    int depth = 0;
+    for (const auto& inst : m_prog) {
+        if (inst.op == op_prim) {
+            ++depth;
+        } else if (inst.op != op_neg) {
+            --depth;
+        }
+        m_max_stack = std::max(m_max_stack, depth);
+    }
+    AMREX_ALWAYS_ASSERT(depth == 1);
+}
+
+Real
+CSGIF::operator() (const RealArray& p) const
+{
+    Real small_stack[csg_small_stack] = {};
+    Vector<Real> big_stack;
+    Real* stack = small_stack;
+    if (m_max_stack > csg_small_stack) {
+        big_stack.resize(m_max_stack);
+        stack = big_stack.data();
+    }
+
+    int top = 0;
+    for (const auto& inst : m_prog)
+    {
+        switch (inst.op) {
+        case op_prim:
+        {
+            const Prim& pr = m_prims[inst.prim];
+            const RealArray q = pr.xform(p);
+            Real v;
+            switch (pr.type) {
+            case sphere:    v = m_spheres   [pr.index](q); break;
+            case ellipsoid: v = m_ellipsoids[pr.index](q); break;
+            case box:       v = m_boxes     [pr.index](q); break;
+            case plane:     v = m_planes    [pr.index](q); break;
+            case cylinder:  v = m_cylinders [pr.index](q); break;
+            default:        v = m_opaques   [pr.index](q); break;
+            }
+            stack[top++] = v;
+            break;
+        }
+        case op_max:
+            --top;
+            stack[top-1] = std::max(stack[top-1], stack[top]);
+            break;
+        case op_min:
+            --top;
+            stack[top-1] = std::min(stack[top-1], stack[top]);
+            break;
+        case op_neg:
+            stack[top-1] = -stack[top-1];
+            break;
+        }
+    }
+    return stack[0];
+}
+
+IFBounds
+CSGIF::primBounds (const Prim& pr, const RealArray& lo, const RealArray& hi) const
+{
+    RealArray mlo, mhi;
+    pr.xform.map(lo, hi, mlo, mhi);
+    switch (pr.type) {
+    case sphere:    return primBoundsT(m_spheres   [pr.index], mlo, mhi);
+    case ellipsoid: return primBoundsT(m_ellipsoids[pr.index], mlo, mhi);
+    case box:       return primBoundsT(m_boxes     [pr.index], mlo, mhi);
+    case plane:     return primBoundsT(m_planes    [pr.index], mlo, mhi);
+    case cylinder:  return primBoundsT(m_cylinders [pr.index], mlo, mhi);
+    default:
+    {
+        const Opaque& o = m_opaques[pr.index];
+        if (o.b) {
+            return o.b(mlo, mhi);
+        } else {
+            const Real big = std::numeric_limits<Real>::max();
+            return {-big, big};
+        }
+    }
+    }
+}
+
+IFBounds
+CSGIF::prune (const Vector<Inst>& prog, const RealArray& lo, const RealArray& hi,
+              Vector<Inst>& pruned) const
+{
+    // Bounds of the subexpressions on the stack, and where their
+    // instructions start in pruned
+    struct Item { IFBounds b; int begin; };
+    Vector<Item> stack;
+    stack.reserve(m_max_stack);
+
+    pruned.clear();
+    for (const auto& inst : prog)
+    {
+        if (inst.op == op_prim)
+        {
+            stack.push_back(Item{primBounds(m_prims[inst.prim], lo, hi),
+                                 static_cast<int>(pruned.size())});
+            pruned.push_back(inst);
+        }
+        else if (inst.op == op_neg)
+        {
+            IFBounds& b = stack.back().b;
+            b = IFBounds{-b.hi, -b.lo};
+            pruned.push_back(inst);
+        }
+        else
+        {
+            const Item B = stack.back();
+            stack.pop_back();
+            Item& A = stack.back();
+            // Does one operand decide the result everywhere?
+            bool keep_a = false, keep_b = false;
+            if (inst.op == op_max) {
+                keep_b = A.b.hi <= B.b.lo;
+                keep_a = !keep_b && B.b.hi <= A.b.lo;
+                A.b = IFBounds{std::max(A.b.lo, B.b.lo), std::max(A.b.hi, B.b.hi)};
+            } else {
+                keep_b = A.b.lo >= B.b.hi;
+                keep_a = !keep_b && B.b.lo >= A.b.hi;
+                A.b = IFBounds{std::min(A.b.lo, B.b.lo), std::min(A.b.hi, B.b.hi)};
+            }
+            if (keep_b) {
+                pruned.erase(pruned.begin()+A.begin, pruned.begin()+B.begin);
+            } else if (keep_a) {
+                pruned.erase(pruned.begin()+B.begin, pruned.end());
+            } else {
+                pruned.push_back(inst);
+            }
+        }
+    }
+    return stack[0].b;
+}
+
+IFBounds
+CSGIF::bounds (const RealArray& lo, const RealArray& hi) const
+{
+    Vector<Inst> pruned;
+    return prune(m_prog, lo, hi, pruned);
+}
+
+int
+CSGIF::numActivePrimitives (const RealArray& lo, const RealArray& hi) const
+{
+    Vector<Inst> pruned;
+    prune(m_prog, lo, hi, pruned);
+    return std::count_if(pruned.begin(), pruned.end(),
+                         [] (const Inst& inst) { return inst.op == op_prim; });
+}
+
+void
+CSGIF::fillFab (BaseFab<Real>& fab, const RealArray& problo, const RealArray& dx) const
+{
+    Vector<Real> work;
+    fillBox(m_prog, fab, fab.box(), problo, dx, work);
+}
+
+void
+CSGIF::fillBox (const Vector<Inst>& prog, BaseFab<Real>& fab, const Box& bx,
+                const RealArray& problo, const RealArray& dx, Vector<Real>& work) const
+{
+    RealArray lo, hi;
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        lo[idim] = problo[idim] + bx.smallEnd(idim)*dx[idim];
+        hi[idim] = problo[idim] + bx.bigEnd(idim)*dx[idim];
+    }
+
+    Vector<Inst> pruned;
+    prune(prog, lo, hi, pruned);
+
+    int dir;
+    const int len = bx.longside(dir);
+    if (len <= csg_tile_size) {
+        evalTile(pruned, fab, bx, problo, dx, work);
+    } else {
+        const int mid = bx.smallEnd(dir) + len/2;
+        Box blo = bx;
+        Box bhi = bx;
+        blo.setBig(dir, mid-1);
+        bhi.setSmall(dir, mid);
+        fillBox(pruned, fab, blo, problo, dx, work);
+        fillBox(pruned, fab, bhi, problo, dx, work);
+    }
+}
+
+void
+CSGIF::evalTile (const Vector<Inst>& prog, BaseFab<Real>& fab, const Box& bx,
+                 const RealArray& problo, const RealArray& dx, Vector<Real>& work) const
+{
+    const int npts = bx.numPts();
+    work.resize(m_max_stack*npts);
+
+    int top = 0;
+    for (const auto& inst : prog)
+    {
+        switch (inst.op) {
+        case op_prim:
+        {
+            const Prim& pr = m_prims[inst.prim];
+            Real* AMREX_RESTRICT out = work.data() + top*npts;
+            switch (pr.type) {
+            case sphere:    evalPrim(m_spheres   [pr.index], pr.xform, bx, problo, dx, out); break;
+            case ellipsoid: evalPrim(m_ellipsoids[pr.index], pr.xform, bx, problo, dx, out); break;
+            case box:       evalPrim(m_boxes     [pr.index], pr.xform, bx, problo, dx, out); break;
+            case plane:     evalPrim(m_planes    [pr.index], pr.xform, bx, problo, dx, out); break;
+            case cylinder:  evalPrim(m_cylinders [pr.index], pr.xform, bx, problo, dx, out); break;
+            default:        evalPrim(m_opaques   [pr.index], pr.xform, bx, problo, dx, out); break;
+            }
+            ++top;
+            break;
+        }
+        case op_max:
+        {
+            --top;
+            Real* AMREX_RESTRICT a = work.data() + (top-1)*npts;
+            const Real* AMREX_RESTRICT b = work.data() + top*npts;
+            AMREX_PRAGMA_SIMD
+            for (int i = 0; i < npts; ++i) {
+                a[i] = std::max(a[i], b[i]);
+            }
+            break;
+        }
+        case op_min:
+        {
+            --top;
+            Real* AMREX_RESTRICT a = work.data() + (top-1)*npts;
+            const Real* AMREX_RESTRICT b = work.data() + top*npts;
+            AMREX_PRAGMA_SIMD
+            for (int i = 0; i < npts; ++i) {
+                a[i] = std::min(a[i], b[i]);
+            }
+            break;
+        }
+        case op_neg:
+        {
+            Real* AMREX_RESTRICT a = work.data() + (top-1)*npts;
+            AMREX_PRAGMA_SIMD
+            for (int i = 0; i < npts; ++i) {
+                a[i] = -a[i];
+            }
+            break;
+        }
+        }
+    }
+
+    const Real* AMREX_RESTRICT v = work.data();
+    const auto lo  = amrex::lbound(bx);
+    const auto len = amrex::length(bx);
+    const auto fp  = fab.view(lo);
+    int n = 0;
+    for         (int k = 0; k < len.z; ++k) {
+        for     (int j = 0; j < len.y; ++j) {
+            for (int i = 0; i < len.x; ++i) {
+                fp(i,j,k,0) = v[n++];
+            }
+        }
+    }
+}
+
+}}
@@ -0,0 +1,488 @@
+
+#include <AMReX_EB2_IF_STL.H>
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_BLProfiler.H>
+#include <AMReX_Utility.H>
+#include <AMReX.H>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+namespace amrex { namespace EB2 {
+
+#if (AMREX_SPACEDIM == 3)
+
+namespace {
+
+    constexpr int stl_leaf_size = 4;
+    constexpr int stl_stack_size = 128;
+
+    // Rays used for the inside/outside test.  The directions are chosen
+    // not to be aligned with the axes.
+    constexpr Real stl_ray_dir[3][3] = {{ 0.8017,  0.4431,  0.4013},
+                                        {-0.3321,  0.8810, -0.3367},
+                                        { 0.2683, -0.4145,  0.8697}};
+
+    inline Real dot (const Real* a, const Real* b) {
+        return a[0]*b[0] + a[1]*b[1] + a[2]*b[2];
+    }
+
+    inline void cross (const Real* a, const Real* b, Real* c) {
+        c[0] = a[1]*b[2] - a[2]*b[1];
+        c[1] = a[2]*b[0] - a[0]*b[2];
+        c[2] = a[0]*b[1] - a[1]*b[0];
+    }
+
+    // Square of the distance between p and triangle (a,b,c)
+    Real triDistance2 (const Real* p, const float* t)
+    {
+        Real a[3], ab[3], ac[3], ap[3];
+        for (int i = 0; i < 3; ++i) {
+            a[i] = t[i];
+            ab[i] = t[3+i] - a[i];
+            ac[i] = t[6+i] - a[i];
+            ap[i] = p[i] - a[i];
+        }
+
+        Real x[3];
+        auto dist2 = [&] () {
+            Real d = 0.0;
+            for (int i = 0; i < 3; ++i) d += (p[i]-x[i])*(p[i]-x[i]);
+            return d;
+        };
+
+        // Voronoi regions of the vertices, edges and face
+        const Real d1 = dot(ab,ap);
+        const Real d2 = dot(ac,ap);
+        if (d1 <= 0.0 && d2 <= 0.0) {
+            for (int i = 0; i < 3; ++i) x[i] = a[i];
+            return dist2();
+        }
+
+        Real bp[3];
+        for (int i = 0; i < 3; ++i) bp[i] = p[i] - t[3+i];
+        const Real d3 = dot(ab,bp);
+        const Real d4 = dot(ac,bp);
+        if (d3 >= 0.0 && d4 <= d3) {
+            for (int i = 0; i < 3; ++i) x[i] = t[3+i];
+            return dist2();
+        }
+
+        const Real vc = d1*d4 - d3*d2;
+        if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0) {
+            const Real v = d1/(d1-d3);
+            for (int i = 0; i < 3; ++i) x[i] = a[i] + v*ab[i];
+            return dist2();
+        }
+
+        Real cp[3];
+        for (int i = 0; i < 3; ++i) cp[i] = p[i] - t[6+i];
+        const Real d5 = dot(ab,cp);
+        const Real d6 = dot(ac,cp);
+        if (d6 >= 0.0 && d5 <= d6) {
+            for (int i = 0; i < 3; ++i) x[i] = t[6+i];
+            return dist2();
+        }
+
+        const Real vb = d5*d2 - d1*d6;
+        if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0) {
+            const Real w = d2/(d2-d6);
+            for (int i = 0; i < 3; ++i) x[i] = a[i] + w*ac[i];
+            return dist2();
+        }
+
+        const Real va = d3*d6 - d5*d4;
+        if (va <= 0.0 && (d4-d3) >= 0.0 && (d5-d6) >= 0.0) {
+            const Real w = (d4-d3)/((d4-d3)+(d5-d6));
+            for (int i = 0; i < 3; ++i) x[i] = t[3+i] + w*(t[6+i]-t[3+i]);
+            return dist2();
+        }
+
+        const Real denom = 1.0/(va+vb+vc);
+        const Real v = vb*denom;
+        const Real w = vc*denom;
+        for (int i = 0; i < 3; ++i) x[i] = a[i] + v*ab[i] + w*ac[i];
+        return dist2();
+    }
+
+    inline Real boxDistance2 (const Real* p, const float* lo, const float* hi)
+    {
+        Real d = 0.0;
+        for (int i = 0; i < 3; ++i) {
+            if (p[i] < lo[i]) {
+                d += (lo[i]-p[i])*(lo[i]-p[i]);
+            } else if (p[i] > hi[i]) {
+                d += (p[i]-hi[i])*(p[i]-hi[i]);
+            }
+        }
+        return d;
+    }
+
+    // Does the ray p + t*dir, t >= 0, hit the box?
+    inline bool rayHitsBox (const Real* p, const Real* invdir, const float* lo, const float* hi)
+    {
+        Real tmin = 0.0;
+        Real tmax = std::numeric_limits<Real>::max();
+        for (int i = 0; i < 3; ++i) {
+            Real t0 = (lo[i]-p[i])*invdir[i];
+            Real t1 = (hi[i]-p[i])*invdir[i];
+            if (t0 > t1) std::swap(t0,t1);
+            tmin = std::max(tmin,t0);
+            tmax = std::min(tmax,t1);
+            if (tmin > tmax) return false;
+        }
+        return true;
+    }
+
+    // Returns 1 if the ray crosses the triangle, 0 if it does not, and -1
+    // if it passes too close to an edge or vertex to tell.
+    int rayCrossesTriangle (const Real* p, const Real* dir, const float* t)
+    {
+        constexpr Real tol = 1.e-9;
+
+        Real e1[3], e2[3], tv[3];
+        for (int i = 0; i < 3; ++i) {
+            e1[i] = t[3+i] - t[i];
+            e2[i] = t[6+i] - t[i];
+            tv[i] = p[i] - t[i];
+        }
+
+        Real pv[3];
+        cross(dir, e2, pv);
+        const Real det = dot(e1, pv);
+        if (det == 0.0) return 0; // parallel to the plane of the triangle
+
+        const Real invdet = 1.0/det;
+        const Real u = dot(tv, pv) * invdet;
+        if (u < -tol || u > 1.0+tol) return 0;
+
+        Real qv[3];
+        cross(tv, e1, qv);
+        const Real v = dot(dir, qv) * invdet;
+        if (v < -tol || u+v > 1.0+tol) return 0;
+
+        const Real s = dot(e2, qv) * invdet;
+        if (s <= 0.0) return 0;
+
+        if (u < tol || v < tol || u+v > 1.0-tol) return -1;
+        return 1;
+    }
+
+    Vector<float> readSTL (const std::string& filename)
+    {
+        std::ifstream ifs(filename, std::ios::in | std::ios::binary);
+        if (!ifs.good()) {
+            amrex::FileOpenFailed(filename);
+        }
+
+        ifs.seekg(0, std::ios::end);
+        const std::streamoff file_size = ifs.tellg();
+        ifs.seekg(0, std::ios::beg);
+
+        Vector<float> tri;
+
+        // A binary file has an 80-byte header, the number of triangles
+        // and 50 bytes per triangle.  An ASCII file starts with "solid",
+        // but so do some binary files, so we check the size first.
+        char header[80];
+        std::uint32_t ntri = 0;
+        bool binary = false;
+        if (file_size >= 84) {
+            ifs.read(header, 80);
+            ifs.read(reinterpret_cast<char*>(&ntri), 4);
+            binary = (file_size == 84 + 50*static_cast<std::streamoff>(ntri));
+        }
+
+        if (binary)
+        {
+            tri.resize(9*static_cast<long>(ntri));
+            char buf[50];
+            for (long n = 0; n < ntri; ++n) {
+                ifs.read(buf, 50);
+                // skip the normal, and the attribute byte count at the end
+                std::memcpy(&tri[9*n], buf+12, 9*sizeof(float));
+            }
+            if (!ifs.good()) {
+                amrex::Abort("STLIF: failed to read binary STL file "+filename);
+            }
+        }
+        else
+        {
+            ifs.clear();
+            ifs.seekg(0, std::ios::beg);
+            std::string word;
+            ifs >> word;
+            if (word != "solid") {
+                amrex::Abort("STLIF: "+filename+" is not an STL file");
+            }
+            while (ifs >> word) {
+                if (word == "vertex") {
+                    double x, y, z;
+                    ifs >> x >> y >> z;
+                    tri.push_back(x);
+                    tri.push_back(y);
+                    tri.push_back(z);
+                }
+            }
+            if (tri.size() % 9 != 0) {
+                amrex::Abort("STLIF: failed to read ASCII STL file "+filename);
+            }
+        }
+
+        return tri;
+    }
+}
+
+STLIF::STLIF (const std::string& a_filename, Real a_scale, const RealArray& a_center,
+              bool a_inside, Real a_max_distance)
+    : m_scale(a_scale), m_center(a_center), m_sign(a_inside ? 1.0 : -1.0),
+      m_max_distance2(std::numeric_limits<Real>::max())
+{
+    BL_PROFILE("EB2::STLIF()");
+
+    Vector<float> tri;
+    long n = 0;
+    const int ioproc = ParallelDescriptor::IOProcessorNumber();
+    if (ParallelDescriptor::IOProcessor()) {
+        tri = readSTL(a_filename);
+        n = tri.size();
+    }
+    ParallelDescriptor::Bcast(&n, 1, ioproc);
+    tri.resize(n);
+    constexpr long chunk = 1L << 30;
+    for (long i = 0; i < n; i += chunk) {
+        ParallelDescriptor::Bcast(tri.data()+i, std::min(chunk, n-i), ioproc);
+    }
+
+    init(std::move(tri), a_max_distance);
+}
+
+STLIF::STLIF (const Vector<Real>& a_triangles, Real a_scale, const RealArray& a_center,
+              bool a_inside, Real a_max_distance)
+    : m_scale(a_scale), m_center(a_center), m_sign(a_inside ? 1.0 : -1.0),
+      m_max_distance2(std::numeric_limits<Real>::max())
+{
+    AMREX_ALWAYS_ASSERT(a_triangles.size() % 9 == 0);
+    Vector<float> tri(a_triangles.begin(), a_triangles.end());
+    init(std::move(tri), a_max_distance);
+}
+
+void
+STLIF::init (Vector<float>&& a_triangles, Real a_max_distance)
+{
+    AMREX_ALWAYS_ASSERT_WITH_MESSAGE(m_scale > 0.0, "STLIF: scale must be positive");
+    AMREX_ALWAYS_ASSERT_WITH_MESSAGE(!a_triangles.empty(), "STLIF: no triangles");
+
+    if (a_max_distance > 0.0) {
+        m_max_distance2 = (a_max_distance/m_scale)*(a_max_distance/m_scale);
+    }
+
+    std::shared_ptr<BVH> bvh = std::make_shared<BVH>();
+    bvh->ntri = a_triangles.size() / 9;
+    bvh->tri = std::move(a_triangles);
+    bvh->build();
+    m_bvh = bvh;
+}
+
+void
+STLIF::BVH::build ()
+{
+    BL_PROFILE("EB2::STLIF::BVH::build()");
+
+    Vector<float> centroid(3*ntri);
+    Vector<int> perm(ntri);
+    for (long n = 0; n < ntri; ++n) {
+        perm[n] = n;
+        for (int i = 0; i < 3; ++i) {
+            centroid[3*n+i] = (tri[9*n+i] + tri[9*n+3+i] + tri[9*n+6+i]) * (1.f/3.f);
+        }
+    }
+
+    nodes.clear();
+    nodes.reserve(2*(ntri/stl_leaf_size+1));
+    nodes.push_back(Node());
+
+    struct Item { int node; long begin; long end; };
+    Vector<Item> todo;
+    todo.push_back({0, 0, ntri});
+    while (!todo.empty())
+    {
+        const Item item = todo.back();
+        todo.pop_back();
+
+        Node nd;
+        float clo[3], chi[3];
+        for (int i = 0; i < 3; ++i) {
+            nd.lo[i] = clo[i] =  std::numeric_limits<float>::max();
+            nd.hi[i] = chi[i] = -std::numeric_limits<float>::max();
+        }
+        for (long k = item.begin; k < item.end; ++k) {
+            const long n = perm[k];
+            for (int i = 0; i < 3; ++i) {
+                for (int v = 0; v < 3; ++v) {
+                    nd.lo[i] = std::min(nd.lo[i], tri[9*n+3*v+i]);
+                    nd.hi[i] = std::max(nd.hi[i], tri[9*n+3*v+i]);
+                }
+                clo[i] = std::min(clo[i], centroid[3*n+i]);
+                chi[i] = std::max(chi[i], centroid[3*n+i]);
+            }
+        }
+
+        // Split at the median centroid along the longest side
+        int dir = 0;
+        for (int i = 1; i < 3; ++i) {
+            if (chi[i]-clo[i] > chi[dir]-clo[dir]) dir = i;
+        }
+
+        const long count = item.end - item.begin;
+        if (count <= stl_leaf_size || chi[dir] <= clo[dir])
+        {
+            nd.first = item.begin;
+            nd.count = count;
+        }
+        else
+        {
+            const long mid = item.begin + count/2;
+            std::nth_element(perm.begin()+item.begin, perm.begin()+mid, perm.begin()+item.end,
+                             [&] (int a, int b) {
+                                 return centroid[3*a+dir] < centroid[3*b+dir];
+                             });
+            nd.first = nodes.size();
+            nd.count = 0;
+            nodes.push_back(Node());
+            nodes.push_back(Node());
+            todo.push_back({nd.first  , item.begin, mid});
+            todo.push_back({nd.first+1, mid, item.end});
+        }
+        nodes[item.node] = nd;
+    }
+
+    // Store the triangles in the order of the leaves
+    Vector<float> sorted(9*ntri);
+    for (long k = 0; k < ntri; ++k) {
+        std::memcpy(&sorted[9*k], &tri[9*static_cast<long>(perm[k])], 9*sizeof(float));
+    }
+    tri = std::move(sorted);
+}
+
+Real
+STLIF::BVH::distance2 (const Real* p, Real max_d2) const
+{
+    Real best = max_d2;
+    int stack[stl_stack_size];
+    int top = 0;
+    stack[top++] = 0;
+    while (top > 0)
+    {
+        const Node& nd = nodes[stack[--top]];
+        if (boxDistance2(p, nd.lo, nd.hi) >= best) continue;
+        if (nd.count > 0) {
+            for (int k = nd.first; k < nd.first+nd.count; ++k) {
+                best = std::min(best, triDistance2(p, &tri[9*static_cast<long>(k)]));
+            }
+        } else {
+            // Visit the nearer child first
+            const Real d0 = boxDistance2(p, nodes[nd.first  ].lo, nodes[nd.first  ].hi);
+            const Real d1 = boxDistance2(p, nodes[nd.first+1].lo, nodes[nd.first+1].hi);
+            AMREX_ASSERT(top+2 <= stl_stack_size);
+            if (d0 < d1) {
+                stack[top++] = nd.first+1;
+                stack[top++] = nd.first;
+            } else {
+                stack[top++] = nd.first;
+                stack[top++] = nd.first+1;
+            }
+        }
+    }
+    return best;
+}
+
+int
+STLIF::BVH::crossings (const Real* p, const Real* dir) const
+{
+    const Real invdir[3] = {1.0/dir[0], 1.0/dir[1], 1.0/dir[2]};
+    int n = 0;
+    int stack[stl_stack_size];
+    int top = 0;
+    stack[top++] = 0;
+    while (top > 0)
+    {
+        const Node& nd = nodes[stack[--top]];
+        if (!rayHitsBox(p, invdir, nd.lo, nd.hi)) continue;
+        if (nd.count > 0) {
+            for (int k = nd.first; k < nd.first+nd.count; ++k) {
+                const int c = rayCrossesTriangle(p, dir, &tri[9*static_cast<long>(k)]);
+                if (c < 0) return -1;
+                n += c;
+            }
+        } else {
+            AMREX_ASSERT(top+2 <= stl_stack_size);
+            stack[top++] = nd.first;
+            stack[top++] = nd.first+1;
+        }
+    }
+    return n;
+}
+
+void
+STLIF::toLocal (const RealArray& p, Real* q) const
+{
+    for (int i = 0; i < 3; ++i) {
+        q[i] = (p[i] - m_center[i]) / m_scale;
+    }
+}
+
+bool
+STLIF::isInside (const Real* q) const
+{
+    for (int r = 0; r < 3; ++r) {
+        const int n = m_bvh->crossings(q, stl_ray_dir[r]);
+        if (n >= 0) return (n % 2) == 1;
+    }
+    // All rays are ambiguous.  This only happens very close to the
+    // surface, where the sign hardly matters.
+    return false;
+}
+
+Real
+STLIF::operator() (const RealArray& p) const
+{
+    Real q[3];
+    toLocal(p, q);
+    const Real d = std::sqrt(m_bvh->distance2(q, m_max_distance2)) * m_scale;
+    if (d == 0.0) return 0.0;
+    return isInside(q) ? -m_sign*d : m_sign*d;
+}
+
+IFBounds
+STLIF::bounds (const RealArray& lo, const RealArray& hi) const
+{
+    // The signed distance is Lipschitz continuous with constant 1.
+    RealArray c;
+    Real r2 = 0.0;
+    for (int i = 0; i < 3; ++i) {
+        c[i] = 0.5*(lo[i]+hi[i]);
+        r2 += 0.25*(hi[i]-lo[i])*(hi[i]-lo[i]);
+    }
+    const Real f = (*this)(c);
+    const Real r = std::sqrt(r2);
+    return IFBounds{f-r, f+r};
+}
+
+void
+STLIF::boundingBox (RealArray& lo, RealArray& hi) const
+{
+    const Node& root = m_bvh->nodes[0];
+    for (int i = 0; i < 3; ++i) {
+        lo[i] = root.lo[i]*m_scale + m_center[i];
+        hi[i] = root.hi[i]*m_scale + m_center[i];
+    }
+}
+
+#endif
+
+}}
@@ -1,10 +1,35 @@
 
 #include <AMReX_EB2_Level.H>
 #include <AMReX_IArrayBox.H>
+#include <AMReX_Utility.H>
+#include <AMReX_BoxIterator.H>
 #include <algorithm>
+#include <fstream>
+#include <sstream>
 
 namespace amrex { namespace EB2 {
 
+void
+Level::gatherBoxes (const BoxArray& grids, Vector<int>& box_type,
+                    Vector<Box>& cut_boxes, Vector<Box>& covered_boxes)
+{
+    // Every process has the BoxArray, so a type per box is all that needs
+    // to be communicated.  This is one reduction instead of gathering the
+    // boxes on the I/O process and broadcasting them.
+    const int n = grids.size();
+    ParallelDescriptor::ReduceIntMax(box_type.data(), n);
+
+    cut_boxes.clear();
+    covered_boxes.clear();
+    for (int i = 0; i < n; ++i) {
+        if (box_type[i] == box_cut) {
+            cut_boxes.push_back(grids[i]);
+        } else if (box_type[i] == box_covered) {
+            covered_boxes.push_back(grids[i]);
+        }
+    }
+}
+
 void
 Level::prepareForCoarsening (const Level& rhs, int max_grid_size, IntVect ngrow)
 {
@@ -13,24 +38,22 @@ Level::prepareForCoarsening (const Level& rhs, int max_grid_size, IntVect ngrow)
     FabArray<EBCellFlagFab> cflag(all_grids, DistributionMapping{all_grids}, 1, 1);
     rhs.fillEBCellFlag(cflag, m_geom);
     
-    Vector<Box> cut_boxes;
-    Vector<Box> covered_boxes;
-
+    Vector<int> box_type(all_grids.size(), box_regular);
     for (MFIter mfi(cflag); mfi.isValid(); ++mfi)
     {
         FabType t = cflag[mfi].getType();
         AMREX_ASSERT(t != FabType::undefined);
-        const Box& vbx = mfi.validbox();
         if (t == FabType::covered) {
-            covered_boxes.push_back(vbx);
+            box_type[mfi.index()] = box_covered;
         } else if (t != FabType::regular) {
-            cut_boxes.push_back(vbx);
+            box_type[mfi.index()] = box_cut;
         }
     }
 
-    amrex::AllGatherBoxes(cut_boxes);
-    amrex::AllGatherBoxes(covered_boxes);
-    
+    Vector<Box> cut_boxes;
+    Vector<Box> covered_boxes;
+    gatherBoxes(all_grids, box_type, cut_boxes, covered_boxes);
+
     if (!covered_boxes.empty()) {
         m_covered_grids = BoxArray(BoxList(std::move(covered_boxes)));
     }
@@ -556,17 +579,19 @@ void
 Level::fillAreaFrac (Array<MultiFab*,AMREX_SPACEDIM> const& a_areafrac, const Geometry& geom) const
 {
     for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
-        a_areafrac[idim]->setVal(1.0);
+        fillAreaFrac(*a_areafrac[idim], idim, geom);
     }
+}
+
+void
+Level::fillAreaFrac (MultiFab& areafrac, int dir, const Geometry& geom) const
+{
+    areafrac.setVal(1.0);
 
     if (isAllRegular()) return;
 
-    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
-    {
-        auto& areafrac = *a_areafrac[idim];
-        areafrac.ParallelCopy(m_areafrac[idim],0,0,areafrac.nComp(),
-                              0,areafrac.nGrow(),geom.periodicity());
-    }
+    areafrac.ParallelCopy(m_areafrac[dir],0,0,areafrac.nComp(),
+                          0,areafrac.nGrow(),geom.periodicity());
 
     const std::vector<IntVect>& pshifts = geom.periodicity().shiftIntVect();
 
@@ -578,17 +603,15 @@ Level::fillAreaFrac (Array<MultiFab*,AMREX_SPACEDIM> const& a_areafrac, const Ge
     if (!m_covered_grids.empty())
     {
         std::vector<std::pair<int,Box> > isects;
-        for (MFIter mfi(*a_areafrac[0]); mfi.isValid(); ++mfi)
+        for (MFIter mfi(areafrac); mfi.isValid(); ++mfi)
         {
-            const Box& ccbx = amrex::enclosedCells((*a_areafrac[0])[mfi].box());
+            const Box& ccbx = amrex::enclosedCells(areafrac[mfi].box());
             for (const auto& iv : pshifts)
             {
                 m_covered_grids.intersections(ccbx+iv, isects);
                 for (const auto& is : isects) {
-                    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
-                        const Box& fbx = amrex::surroundingNodes(is.second-iv,idim);
-                        (*a_areafrac[idim])[mfi].setVal(cov_val, fbx, 0, 1);
-                    }
+                    const Box& fbx = amrex::surroundingNodes(is.second-iv,dir);
+                    areafrac[mfi].setVal(cov_val, fbx, 0, 1);
                 }
             }
         }
@@ -621,15 +644,17 @@ void
 Level::fillFaceCent (Array<MultiFab*,AMREX_SPACEDIM> const& a_facecent, const Geometry& geom) const
 {
     for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
-        a_facecent[idim]->setVal(0.0);
+        fillFaceCent(*a_facecent[idim], idim, geom);
     }
+}
+
+void
+Level::fillFaceCent (MultiFab& facecent, int dir, const Geometry& geom) const
+{
+    facecent.setVal(0.0);
     if (!isAllRegular()) {
-        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
-        {
-            auto& facecent = *a_facecent[idim];
-            a_facecent[idim]->ParallelCopy(m_facecent[idim],0,0,facecent.nComp(),
-                                           0,facecent.nGrow(),geom.periodicity());
-        }
+        facecent.ParallelCopy(m_facecent[dir],0,0,facecent.nComp(),
+                              0,facecent.nGrow(),geom.periodicity());
     }
 }
 
@@ -664,5 +689,146 @@ Level::fillLevelSet (MultiFab& levelset, const Geometry& geom) const
         }
     }
 }
-        
+
+namespace {
+    // BoxArray::readFrom does not handle empty BoxArrays.
+    void writeBoxArray (std::ostream& os, const BoxArray& ba)
+    {
+        os << ba.size() << "\n";
+        for (int i = 0; i < ba.size(); ++i) {
+            os << ba[i] << "\n";
+        }
+    }
+
+    BoxArray readBoxArray (std::istream& is)
+    {
+        int n;
+        is >> n;
+        BoxList bl;
+        for (int i = 0; i < n; ++i) {
+            Box b;
+            is >> b;
+            bl.push_back(b);
+        }
+        return (n > 0) ? BoxArray(std::move(bl)) : BoxArray();
+    }
+
+    // VisMF::Read resizes the fabs if the file has a different number of
+    // ghost cells, so check that the data fit mf.
+    void readMultiFab (MultiFab& mf, const std::string& name)
+    {
+        VisMF::Read(mf, name);
+        for (MFIter mfi(mf); mfi.isValid(); ++mfi) {
+            if (mf[mfi].box() != mfi.fabbox()) {
+                amrex::Abort("EB2::Level::readCache: wrong number of ghost cells in "+name);
+            }
+        }
+    }
+}
+
+void
+Level::writeCache (const std::string& dir) const
+{
+    BL_PROFILE("EB2::Level::writeCache()");
+
+    if (ParallelDescriptor::IOProcessor())
+    {
+        std::ofstream ofs(dir + "/Header");
+        if (!ofs.good()) amrex::FileOpenFailed(dir + "/Header");
+        // The level set of the finest level has the ghost nodes of GFab.
+        ofs << m_allregular << " " << m_ok << "\n"
+            << m_ngrow << " " << m_levelset.nGrow() << "\n";
+        writeBoxArray(ofs, m_grids);
+        writeBoxArray(ofs, m_covered_grids);
+    }
+
+    if (m_allregular || m_grids.empty()) return;
+
+    // EBCellFlag is stored as Real, which holds a 32-bit integer exactly.
+    MultiFab flag(m_grids, m_dmap, 1, m_cellflag.nGrow());
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(flag); mfi.isValid(); ++mfi)
+    {
+        const auto& cfab = m_cellflag[mfi];
+        auto& rfab = flag[mfi];
+        for (BoxIterator bi(rfab.box()); bi.ok(); ++bi) {
+            rfab(bi()) = static_cast<Real>(cfab(bi()).getValue());
+        }
+    }
+
+    VisMF::Write(flag, dir + "/CellFlag");
+    VisMF::Write(m_levelset, dir + "/LevelSet");
+    VisMF::Write(m_volfrac, dir + "/VolFrac");
+    VisMF::Write(m_centroid, dir + "/Centroid");
+    VisMF::Write(m_bndryarea, dir + "/BndryArea");
+    VisMF::Write(m_bndrycent, dir + "/BndryCent");
+    VisMF::Write(m_bndrynorm, dir + "/BndryNorm");
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        VisMF::Write(m_areafrac[idim], dir + "/AreaFrac_" + std::to_string(idim));
+        VisMF::Write(m_facecent[idim], dir + "/FaceCent_" + std::to_string(idim));
+    }
+}
+
+void
+Level::readCache (const std::string& dir)
+{
+    BL_PROFILE("EB2::Level::readCache()");
+
+    Vector<char> fileCharPtr;
+    ParallelDescriptor::ReadAndBcastFile(dir + "/Header", fileCharPtr);
+    std::string fileCharPtrString(fileCharPtr.dataPtr());
+    std::istringstream is(fileCharPtrString, std::istringstream::in);
+
+    int ng_levelset;
+    is >> m_allregular >> m_ok >> m_ngrow >> ng_levelset;
+    m_grids = readBoxArray(is);
+    m_covered_grids = readBoxArray(is);
+
+    if (m_allregular || m_grids.empty()) return;
+
+    m_dmap = DistributionMapping(m_grids);
+
+    const int ng = 2;
+    m_levelset.define(amrex::convert(m_grids,IntVect::TheNodeVector()), m_dmap, 1, ng_levelset);
+    m_cellflag.define(m_grids, m_dmap, 1, ng);
+    m_volfrac.define(m_grids, m_dmap, 1, ng);
+    m_centroid.define(m_grids, m_dmap, AMREX_SPACEDIM, ng);
+    m_bndryarea.define(m_grids, m_dmap, 1, ng);
+    m_bndrycent.define(m_grids, m_dmap, AMREX_SPACEDIM, ng);
+    m_bndrynorm.define(m_grids, m_dmap, AMREX_SPACEDIM, ng);
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        m_areafrac[idim].define(amrex::convert(m_grids, IntVect::TheDimensionVector(idim)),
+                                m_dmap, 1, ng);
+        m_facecent[idim].define(amrex::convert(m_grids, IntVect::TheDimensionVector(idim)),
+                                m_dmap, AMREX_SPACEDIM-1, ng);
+    }
+
+    MultiFab flag(m_grids, m_dmap, 1, ng);
+    readMultiFab(flag, dir + "/CellFlag");
+    readMultiFab(m_levelset, dir + "/LevelSet");
+    readMultiFab(m_volfrac, dir + "/VolFrac");
+    readMultiFab(m_centroid, dir + "/Centroid");
+    readMultiFab(m_bndryarea, dir + "/BndryArea");
+    readMultiFab(m_bndrycent, dir + "/BndryCent");
+    readMultiFab(m_bndrynorm, dir + "/BndryNorm");
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        readMultiFab(m_areafrac[idim], dir + "/AreaFrac_" + std::to_string(idim));
+        readMultiFab(m_facecent[idim], dir + "/FaceCent_" + std::to_string(idim));
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(flag); mfi.isValid(); ++mfi)
+    {
+        auto& cfab = m_cellflag[mfi];
+        const auto& rfab = flag[mfi];
+        for (BoxIterator bi(rfab.box()); bi.ok(); ++bi) {
+            cfab(bi()) = EBCellFlag(static_cast<uint32_t>(rfab(bi())));
+        }
+    }
+}
+
 }}
@@ -3,6 +3,9 @@
 #include <AMReX_EBAmrUtil_F.H>
 #include <AMReX_EBFArrayBox.H>
 #include <AMReX_EBCellFlag.H>
+#include <AMReX_EBCellFlag_F.H>
+#include <AMReX_EB2.H>
+#include <AMReX_ParallelReduce.H>
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -65,4 +68,60 @@ TagVolfrac (TagBoxArray& tags, const MultiFab& volfrac, Real tol)
     }
 }
 
+
+Vector<Real>
+EBBoxCosts (const FabArray<EBCellFlagFab>& flags)
+{
+    BL_PROFILE("amrex::EBBoxCosts()");
+
+    Vector<Real> cost(flags.size(), 0.0);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(flags); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.validbox();
+        const auto& flag = flags[mfi];
+        const FabType typ = flag.getType();
+        Real c;
+        if (typ == FabType::regular) {
+            c = EB2::lb_cost_regular * bx.numPts();
+        } else if (typ == FabType::covered) {
+            c = EB2::lb_cost_covered * bx.numPts();
+        } else {
+            int nregular, nsingle, nmulti, ncovered;
+            amrex_ebcellflag_count(BL_TO_FORTRAN_BOX(bx),
+                                   BL_TO_FORTRAN_ANYD(flag),
+                                   &nregular, &nsingle, &nmulti, &ncovered);
+            const int ncut = nsingle + nmulti;
+            if (ncut > 0) {
+                c = EB2::lb_cost_mixed * (nregular + ncovered) + EB2::lb_cost_cut * ncut;
+            } else {
+                c = EB2::lb_cost_regular * nregular + EB2::lb_cost_covered * ncovered;
+            }
+        }
+        cost[mfi.index()] = c;
+    }
+
+    ParallelAllReduce::Sum(cost.data(), cost.size(), ParallelContext::CommunicatorSub());
+
+    return cost;
+}
+
+DistributionMapping
+EBDistributionMapping (const BoxArray& ba, const Geometry& geom)
+{
+    BL_PROFILE("amrex::EBDistributionMapping()");
+
+    DistributionMapping dm(ba);
+    if (ParallelContext::NProcsSub() == 1 || ba.empty()) return dm;
+
+    const EB2::Level& eb_level = EB2::IndexSpace::top().getLevel(geom);
+    FabArray<EBCellFlagFab> flags(ba, dm, 1, 0);
+    eb_level.fillEBCellFlag(flags, geom);
+
+    return DistributionMapping::makeKnapSack(EBBoxCosts(flags));
+}
+
 }
@@ -0,0 +1,567 @@
+
+#include <AMReX_EBCutCellData.H>
+#include <AMReX_MultiCutFab.H>
+#include <AMReX_MultiFab.H>
+#include <AMReX_BoxIterator.H>
+
+#include <algorithm>
+#include <utility>
+
+namespace amrex {
+
+namespace {
+
+    // Fortran order
+    struct IVLess
+    {
+        bool operator() (const IntVect& a, const IntVect& b) const {
+#if (AMREX_SPACEDIM == 3)
+            if (a[2] != b[2]) return a[2] < b[2];
+#endif
+#if (AMREX_SPACEDIM >= 2)
+            if (a[1] != b[1]) return a[1] < b[1];
+#endif
+            return a[0] < b[0];
+        }
+    };
+
+    // Default area fraction of a face that is not in the list: 1 if the
+    // cells on both sides are regular, 0 otherwise.  Cells outside the
+    // flag fab are ignored.
+    Real defaultAreaFrac (const EBCellFlagFab& flag, const IntVect& iv, int dir)
+    {
+        const Box& bx = flag.box();
+        const IntVect ivlo = iv - IntVect::TheDimensionVector(dir);
+        bool regular = true;
+        if (bx.contains(ivlo)) regular = regular && flag(ivlo).isRegular();
+        if (bx.contains(iv  )) regular = regular && flag(iv  ).isRegular();
+        return regular ? 1.0 : 0.0;
+    }
+
+    Real defaultVolFrac (const EBCellFlag& f)
+    {
+        return f.isRegular() ? 1.0 : 0.0;
+    }
+
+    bool hasCutCell (const EBCellFlagFab& flag, const IntVect& iv, int dir)
+    {
+        const Box& bx = flag.box();
+        const IntVect ivlo = iv - IntVect::TheDimensionVector(dir);
+        return (bx.contains(ivlo) && flag(ivlo).isSingleValued())
+            || (bx.contains(iv  ) && flag(iv  ).isSingleValued());
+    }
+
+    bool differs (const FArrayBox* fab, const IntVect& iv, Real default_val)
+    {
+        if (fab && fab->box().contains(iv)) {
+            for (int n = 0; n < fab->nComp(); ++n) {
+                if ((*fab)(iv,n) != default_val) return true;
+            }
+        }
+        return false;
+    }
+
+    void gather (Vector<Real>& v, const FArrayBox* fab, int ncomp,
+                 const Vector<IntVect>& ivs, Real default_val)
+    {
+        if (ncomp == 0) return;
+        const int npts = ivs.size();
+        v.resize(ncomp*npts, default_val);
+        if (fab == nullptr) return;
+        const Box& bx = fab->box();
+        for (int i = 0; i < npts; ++i) {
+            if (bx.contains(ivs[i])) {
+                for (int n = 0; n < ncomp; ++n) {
+                    v[n*npts+i] = (*fab)(ivs[i],n);
+                }
+            }
+        }
+    }
+
+    const FArrayBox* fabPtr (const MultiFab* mf, const MFIter& mfi)
+    {
+        return (mf) ? &((*mf)[mfi]) : nullptr;
+    }
+
+    // Merges the sorted points newpts, which are not in ivs, into the
+    // sorted ivs.  Returns the old index of each point of the new ivs, or
+    // -1 for the new points.
+    Vector<int> mergePoints (Vector<IntVect>& ivs, const Vector<IntVect>& newpts)
+    {
+        const int nold = ivs.size();
+        const int nnew = newpts.size();
+        Vector<IntVect> r;
+        Vector<int> old;
+        r.reserve(nold+nnew);
+        old.reserve(nold+nnew);
+        IVLess less;
+        int i = 0, j = 0;
+        while (i < nold || j < nnew) {
+            if (j == nnew || (i < nold && less(ivs[i], newpts[j]))) {
+                r.push_back(ivs[i]);
+                old.push_back(i++);
+            } else {
+                r.push_back(newpts[j++]);
+                old.push_back(-1);
+            }
+        }
+        ivs.swap(r);
+        return old;
+    }
+
+    // Moves the data of nold points to the points ivs returned by
+    // mergePoints, with default_val(iv) at the new points.
+    template <class F>
+    void remapData (Vector<Real>& v, int ncomp, int nold, const Vector<int>& old,
+                    const Vector<IntVect>& ivs, F&& default_val)
+    {
+        const int npts = ivs.size();
+        Vector<Real> r(ncomp*npts);
+        for (int i = 0; i < npts; ++i) {
+            const int k = old[i];
+            const Real dval = (k < 0) ? default_val(ivs[i]) : 0.0;
+            for (int n = 0; n < ncomp; ++n) {
+                r[n*npts+i] = (k < 0) ? dval : v[n*nold+k];
+            }
+        }
+        v.swap(r);
+    }
+
+    // The points of a sorted list in bx are in [first,second).  Not all
+    // of the points in the range are in bx.
+    std::pair<int,int> pointRange (const Vector<IntVect>& ivs, const Box& bx)
+    {
+        auto lo = std::lower_bound(ivs.begin(), ivs.end(), bx.smallEnd(), IVLess());
+        auto hi = std::upper_bound(lo, ivs.end(), bx.bigEnd(), IVLess());
+        return std::make_pair(static_cast<int>(lo - ivs.begin()),
+                              static_cast<int>(hi - ivs.begin()));
+    }
+}
+
+int
+EBCutCellData::PointList::index (const IntVect& a_iv) const
+{
+    auto it = std::lower_bound(iv.begin(), iv.end(), a_iv, IVLess());
+    if (it != iv.end() && *it == a_iv) {
+        return static_cast<int>(it - iv.begin());
+    } else {
+        return -1;
+    }
+}
+
+std::size_t
+EBCutCellData::nBytes () const
+{
+    std::size_t r = m_cells.iv.capacity()*sizeof(IntVect)
+        + (m_volfrac.capacity() + m_centroid.capacity() + m_bndrycent.capacity()
+           + m_bndryarea.capacity() + m_bndrynorm.capacity())*sizeof(Real);
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        r += m_faces[idim].iv.capacity()*sizeof(IntVect)
+            + (m_areafrac[idim].capacity() + m_facecent[idim].capacity())*sizeof(Real);
+    }
+    return r;
+}
+
+MultiEBCutCellData::MultiEBCutCellData (const FabArray<EBCellFlagFab>& cellflags,
+                                        const MultiFab* volfrac, const MultiCutFab* centroid,
+                                        const MultiCutFab* bndrycent, const MultiCutFab* bndryarea,
+                                        const MultiCutFab* bndrynorm,
+                                        const Array<const MultiCutFab*,AMREX_SPACEDIM>& areafrac,
+                                        const Array<const MultiCutFab*,AMREX_SPACEDIM>& facecent)
+    : m_cellflags(&cellflags),
+      m_data(cellflags.boxArray(), cellflags.DistributionMap())
+{
+    BL_PROFILE("MultiEBCutCellData()");
+
+    initCells(volfrac);
+    if (centroid ) addCellData(*centroid , field_centroid);
+    if (bndrycent) addCellData(*bndrycent, field_bndrycent);
+    if (bndryarea) addCellData(*bndryarea, field_bndryarea);
+    if (bndrynorm) addCellData(*bndrynorm, field_bndrynorm);
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
+    {
+        if (areafrac[idim] == nullptr) continue;
+        addFaceData(*areafrac[idim], idim, field_areafrac);
+        if (facecent[idim]) addFaceData(*facecent[idim], idim, field_facecent);
+    }
+}
+
+MultiEBCutCellData::MultiEBCutCellData (const FabArray<EBCellFlagFab>& cellflags,
+                                        const MultiFab& volfrac)
+    : m_cellflags(&cellflags),
+      m_data(cellflags.boxArray(), cellflags.DistributionMap())
+{
+    BL_PROFILE("MultiEBCutCellData()");
+
+    initCells(&volfrac);
+}
+
+void
+MultiEBCutCellData::addCentroid (const MultiFab& centroid)
+{
+    addCellData(centroid, field_centroid);
+}
+
+void
+MultiEBCutCellData::addBndryCent (const MultiFab& bndrycent)
+{
+    addCellData(bndrycent, field_bndrycent);
+}
+
+void
+MultiEBCutCellData::addBndryArea (const MultiFab& bndryarea)
+{
+    addCellData(bndryarea, field_bndryarea);
+}
+
+void
+MultiEBCutCellData::addBndryNorm (const MultiFab& bndrynorm)
+{
+    addCellData(bndrynorm, field_bndrynorm);
+}
+
+void
+MultiEBCutCellData::addAreaFrac (const MultiFab& areafrac, int dir)
+{
+    addFaceData(areafrac, dir, field_areafrac);
+}
+
+void
+MultiEBCutCellData::addFaceCent (const MultiFab& facecent, int dir)
+{
+    addFaceData(facecent, dir, field_facecent);
+}
+
+void
+MultiEBCutCellData::initCells (const MultiFab* volfrac)
+{
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(*m_cellflags); mfi.isValid(); ++mfi)
+    {
+        const EBCellFlagFab& flag = (*m_cellflags)[mfi];
+        if (flag.getType() != FabType::singlevalued) continue;
+
+        EBCutCellData& cc = m_data[mfi];
+        const Box& bx = flag.box();
+        const FArrayBox* fvolfrac = fabPtr(volfrac, mfi);
+
+        cc.m_cells.box = bx;
+        for (BoxIterator bi(bx); bi.ok(); ++bi)
+        {
+            const IntVect& iv = bi();
+            const EBCellFlag& f = flag(iv);
+            if (f.isSingleValued() || differs(fvolfrac, iv, defaultVolFrac(f))) {
+                cc.m_cells.iv.push_back(iv);
+            }
+        }
+
+        gather(cc.m_volfrac, fvolfrac, (volfrac) ? 1 : 0, cc.m_cells.iv, 0.0);
+    }
+
+    if (volfrac) m_fields |= field_volfrac;
+}
+
+template <class MF>
+void
+MultiEBCutCellData::addCellData (const MF& mf, Field field)
+{
+    Vector<Real> EBCutCellData::*data;
+    Real default_val = 0.0;
+    if (field == field_centroid) {
+        data = &EBCutCellData::m_centroid;
+    } else if (field == field_bndrycent) {
+        data = &EBCutCellData::m_bndrycent;
+        default_val = -1.0;
+    } else if (field == field_bndryarea) {
+        data = &EBCutCellData::m_bndryarea;
+    } else {
+        data = &EBCutCellData::m_bndrynorm;
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(*m_cellflags); mfi.isValid(); ++mfi)
+    {
+        const EBCellFlagFab& flag = (*m_cellflags)[mfi];
+        if (flag.getType() != FabType::singlevalued) continue;
+
+        EBCutCellData& cc = m_data[mfi];
+        const FArrayBox& fab = mf[mfi];
+
+        // Cells that are not in the list yet, but whose data differ from
+        // the default
+        Vector<IntVect> newpts;
+        for (BoxIterator bi(fab.box() & cc.box()); bi.ok(); ++bi) {
+            if (differs(&fab, bi(), default_val) && cc.cellIndex(bi()) < 0) {
+                newpts.push_back(bi());
+            }
+        }
+        if (!newpts.empty()) insertCells(cc, flag, newpts);
+
+        gather(cc.*data, &fab, fab.nComp(), cc.m_cells.iv, default_val);
+    }
+
+    m_fields |= field;
+}
+
+template <class MF>
+void
+MultiEBCutCellData::addFaceData (const MF& mf, int dir, Field field)
+{
+    const bool is_areafrac = (field == field_areafrac);
+    const bool has_faces = m_fields & ((field_areafrac | field_facecent) << dir);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(*m_cellflags); mfi.isValid(); ++mfi)
+    {
+        const EBCellFlagFab& flag = (*m_cellflags)[mfi];
+        if (flag.getType() != FabType::singlevalued) continue;
+
+        EBCutCellData& cc = m_data[mfi];
+        const FArrayBox& fab = mf[mfi];
+        auto& faces = cc.m_faces[dir];
+
+        if (!has_faces)
+        {
+            faces.box = amrex::surroundingNodes(cc.box(), dir);
+            for (BoxIterator bi(faces.box); bi.ok(); ++bi) {
+                if (hasCutCell(flag, bi(), dir)) faces.iv.push_back(bi());
+            }
+        }
+
+        Vector<IntVect> newpts;
+        for (BoxIterator bi(fab.box() & faces.box); bi.ok(); ++bi)
+        {
+            const IntVect& iv = bi();
+            const Real default_val = is_areafrac ? defaultAreaFrac(flag, iv, dir) : 0.0;
+            if (differs(&fab, iv, default_val) && faces.index(iv) < 0) {
+                newpts.push_back(iv);
+            }
+        }
+        if (!newpts.empty()) insertFaces(cc, flag, dir, newpts);
+
+        Vector<Real>& v = is_areafrac ? cc.m_areafrac[dir] : cc.m_facecent[dir];
+        gather(v, &fab, fab.nComp(), faces.iv, 0.0);
+    }
+
+    m_fields |= field << dir;
+}
+
+void
+MultiEBCutCellData::insertCells (EBCutCellData& cc, const EBCellFlagFab& flag,
+                                 const Vector<IntVect>& newpts) const
+{
+    const int nold = cc.numCells();
+    const Vector<int>& old = mergePoints(cc.m_cells.iv, newpts);
+    const Vector<IntVect>& ivs = cc.m_cells.iv;
+
+    if (m_fields & field_volfrac) {
+        remapData(cc.m_volfrac, 1, nold, old, ivs,
+                  [&flag] (const IntVect& iv) -> Real { return defaultVolFrac(flag(iv)); });
+    }
+    if (m_fields & field_centroid) {
+        remapData(cc.m_centroid, AMREX_SPACEDIM, nold, old, ivs,
+                  [] (const IntVect&) -> Real { return 0.0; });
+    }
+    if (m_fields & field_bndrycent) {
+        remapData(cc.m_bndrycent, AMREX_SPACEDIM, nold, old, ivs,
+                  [] (const IntVect&) -> Real { return -1.0; });
+    }
+    if (m_fields & field_bndryarea) {
+        remapData(cc.m_bndryarea, 1, nold, old, ivs,
+                  [] (const IntVect&) -> Real { return 0.0; });
+    }
+    if (m_fields & field_bndrynorm) {
+        remapData(cc.m_bndrynorm, AMREX_SPACEDIM, nold, old, ivs,
+                  [] (const IntVect&) -> Real { return 0.0; });
+    }
+}
+
+void
+MultiEBCutCellData::insertFaces (EBCutCellData& cc, const EBCellFlagFab& flag, int dir,
+                                 const Vector<IntVect>& newpts) const
+{
+    const int nold = cc.numFaces(dir);
+    const Vector<int>& old = mergePoints(cc.m_faces[dir].iv, newpts);
+    const Vector<IntVect>& ivs = cc.m_faces[dir].iv;
+
+    if (m_fields & (field_areafrac << dir)) {
+        remapData(cc.m_areafrac[dir], 1, nold, old, ivs,
+                  [&flag,dir] (const IntVect& iv) -> Real { return defaultAreaFrac(flag, iv, dir); });
+    }
+    if (m_fields & (field_facecent << dir)) {
+        remapData(cc.m_facecent[dir], AMREX_SPACEDIM-1, nold, old, ivs,
+                  [] (const IntVect&) -> Real { return 0.0; });
+    }
+}
+
+void
+MultiEBCutCellData::fillCellData (MultiCutFab& mf, Vector<Real> EBCutCellData::*data,
+                                  Real default_val) const
+{
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(mf.data()); mfi.isValid(); ++mfi)
+    {
+        if (mf.ok(mfi)) fillCellData(mf[mfi], mfi, data, default_val);
+    }
+}
+
+void
+MultiEBCutCellData::fillCellData (FArrayBox& fab, const MFIter& mfi,
+                                  Vector<Real> EBCutCellData::*data, Real default_val) const
+{
+    fab.setVal(default_val);
+
+    const EBCutCellData& cc = m_data[mfi];
+    const Vector<Real>& v = cc.*data;
+    if (v.empty()) return;
+
+    const Box& bx = fab.box();
+    const int ncomp = fab.nComp();
+    const int npts = cc.numCells();
+    const auto r = pointRange(cc.m_cells.iv, bx);
+    for (int i = r.first; i < r.second; ++i) {
+        const IntVect& iv = cc.cell(i);
+        if (bx.contains(iv)) {
+            for (int n = 0; n < ncomp; ++n) {
+                fab(iv,n) = v[n*npts+i];
+            }
+        }
+    }
+}
+
+void
+MultiEBCutCellData::fillCentroid (MultiCutFab& centroid) const
+{
+    fillCellData(centroid, &EBCutCellData::m_centroid, 0.0);
+}
+
+void
+MultiEBCutCellData::fillBndryCent (MultiCutFab& bndrycent) const
+{
+    fillCellData(bndrycent, &EBCutCellData::m_bndrycent, -1.0);
+}
+
+void
+MultiEBCutCellData::fillBndryArea (MultiCutFab& bndryarea) const
+{
+    fillCellData(bndryarea, &EBCutCellData::m_bndryarea, 0.0);
+}
+
+void
+MultiEBCutCellData::fillBndryNorm (MultiCutFab& bndrynorm) const
+{
+    fillCellData(bndrynorm, &EBCutCellData::m_bndrynorm, 0.0);
+}
+
+void
+MultiEBCutCellData::fillAreaFrac (MultiCutFab& areafrac, int dir) const
+{
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(areafrac.data()); mfi.isValid(); ++mfi)
+    {
+        if (areafrac.ok(mfi)) fillAreaFrac(areafrac[mfi], mfi, dir);
+    }
+}
+
+void
+MultiEBCutCellData::fillFaceCent (MultiCutFab& facecent, int dir) const
+{
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(facecent.data()); mfi.isValid(); ++mfi)
+    {
+        if (facecent.ok(mfi)) fillFaceCent(facecent[mfi], mfi, dir);
+    }
+}
+
+void
+MultiEBCutCellData::fillCentroid (FArrayBox& centroid, const MFIter& mfi) const
+{
+    fillCellData(centroid, mfi, &EBCutCellData::m_centroid, 0.0);
+}
+
+void
+MultiEBCutCellData::fillBndryCent (FArrayBox& bndrycent, const MFIter& mfi) const
+{
+    fillCellData(bndrycent, mfi, &EBCutCellData::m_bndrycent, -1.0);
+}
+
+void
+MultiEBCutCellData::fillBndryArea (FArrayBox& bndryarea, const MFIter& mfi) const
+{
+    fillCellData(bndryarea, mfi, &EBCutCellData::m_bndryarea, 0.0);
+}
+
+void
+MultiEBCutCellData::fillBndryNorm (FArrayBox& bndrynorm, const MFIter& mfi) const
+{
+    fillCellData(bndrynorm, mfi, &EBCutCellData::m_bndrynorm, 0.0);
+}
+
+void
+MultiEBCutCellData::fillAreaFrac (FArrayBox& fab, const MFIter& mfi, int dir) const
+{
+    const EBCellFlagFab& flag = (*m_cellflags)[mfi];
+    const Box& bx = fab.box();
+    for (BoxIterator bi(bx); bi.ok(); ++bi) {
+        fab(bi()) = defaultAreaFrac(flag, bi(), dir);
+    }
+
+    const EBCutCellData& cc = m_data[mfi];
+    const Vector<Real>& v = cc.m_areafrac[dir];
+    if (v.empty()) return;
+
+    const auto r = pointRange(cc.m_faces[dir].iv, bx);
+    for (int i = r.first; i < r.second; ++i) {
+        const IntVect& iv = cc.face(dir,i);
+        if (bx.contains(iv)) {
+            fab(iv) = v[i];
+        }
+    }
+}
+
+void
+MultiEBCutCellData::fillFaceCent (FArrayBox& fab, const MFIter& mfi, int dir) const
+{
+    fab.setVal(0.0);
+
+    const EBCutCellData& cc = m_data[mfi];
+    const Vector<Real>& v = cc.m_facecent[dir];
+    if (v.empty()) return;
+
+    const Box& bx = fab.box();
+    const int ncomp = fab.nComp();
+    const int npts = cc.numFaces(dir);
+    const auto r = pointRange(cc.m_faces[dir].iv, bx);
+    for (int i = r.first; i < r.second; ++i) {
+        const IntVect& iv = cc.face(dir,i);
+        if (bx.contains(iv)) {
+            for (int n = 0; n < ncomp; ++n) {
+                fab(iv,n) = v[n*npts+i];
+            }
+        }
+    }
+}
+
+std::size_t
+MultiEBCutCellData::nBytes () const
+{
+    std::size_t r = 0;
+    for (MFIter mfi(*m_cellflags); mfi.isValid(); ++mfi) {
+        r += m_data[mfi].nBytes();
+    }
+    return r;
+}
+
+}
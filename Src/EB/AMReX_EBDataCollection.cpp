@@ -2,8 +2,9 @@
 #include <AMReX_EBDataCollection.H>
 #include <AMReX_MultiFab.H>
 #include <AMReX_MultiCutFab.H>
+#include <AMReX_EBCutCellData.H>
 
-#include <AMReX_EB2_Level.H>
+#include <AMReX_EB2.H>
 
 namespace amrex {
 
@@ -14,10 +15,16 @@ EBDataCollection::EBDataCollection (const EB2::Level& a_level,
                                     const Vector<int>& a_ngrow, EBSupport a_support)
     : m_ngrow(a_ngrow),
       m_support(a_support),
-      m_geom(a_geom)
+      m_geom(a_geom),
+      // The BoxArray argument may not be cell-centered BoxArray.
+      m_ba(amrex::convert(a_ba_in, IntVect::TheZeroVector())),
+      m_dm(a_dm)
 {
-    // The BoxArray argument may not be cell-centered BoxArray.
-    const BoxArray& a_ba = amrex::convert(a_ba_in, IntVect::TheZeroVector());
+    const BoxArray& a_ba = m_ba;
+
+    m_sparse = EB2::sparse_cut_data && m_support >= EBSupport::volume
+        && m_ngrow[0] >= m_ngrow[1]
+        && (m_support < EBSupport::full || m_ngrow[0] >= m_ngrow[2]);
 
     if (m_support >= EBSupport::basic)
     {
@@ -30,7 +37,17 @@ EBDataCollection::EBDataCollection (const EB2::Level& a_level,
     {
         m_volfrac = new MultiFab(a_ba, a_dm, 1, m_ngrow[1], MFInfo(), FArrayBoxFactory());
         a_level.fillVolFrac(*m_volfrac, m_geom);
+    }
+
+    if (m_sparse)
+    {
+        m_cutcelldata = buildCutCellData(a_level);
+        m_cutcell_built = true;
+        return;
+    }
 
+    if (m_support >= EBSupport::volume)
+    {
         m_centroid = new MultiCutFab(a_ba, a_dm, AMREX_SPACEDIM, m_ngrow[1], *m_cellflags);
         a_level.fillCentroid(*m_centroid, m_geom);
     }
@@ -63,14 +80,179 @@ EBDataCollection::~EBDataCollection ()
 {
     delete m_cellflags;
     delete m_volfrac;
+    deleteDense();
+    delete m_cutcelldata;
+}
+
+MultiEBCutCellData*
+EBDataCollection::buildCutCellData () const
+{
+    Array<const MultiCutFab*,AMREX_SPACEDIM> areafrac {{AMREX_D_DECL(m_areafrac[0],
+                                                                      m_areafrac[1],
+                                                                      m_areafrac[2])}};
+    Array<const MultiCutFab*,AMREX_SPACEDIM> facecent {{AMREX_D_DECL(m_facecent[0],
+                                                                      m_facecent[1],
+                                                                      m_facecent[2])}};
+    return new MultiEBCutCellData(*m_cellflags, m_volfrac, m_centroid,
+                                  m_bndrycent, m_bndryarea, m_bndrynorm,
+                                  areafrac, facecent);
+}
+
+MultiEBCutCellData*
+EBDataCollection::buildCutCellData (const EB2::Level& a_level) const
+{
+    BL_PROFILE("EBDataCollection::buildCutCellData()");
+
+    // The dense data are filled one field at a time into a temporary
+    // MultiFab, so that at most one of them exists at a time.
+    auto r = new MultiEBCutCellData(*m_cellflags, *m_volfrac);
+    {
+        MultiFab tmp(m_ba, m_dm, AMREX_SPACEDIM, m_ngrow[1]);
+        a_level.fillCentroid(tmp, m_geom);
+        r->addCentroid(tmp);
+    }
+
+    if (m_support == EBSupport::full)
+    {
+        const int ng = m_ngrow[2];
+        {
+            MultiFab tmp(m_ba, m_dm, AMREX_SPACEDIM, ng);
+            a_level.fillBndryCent(tmp, m_geom);
+            r->addBndryCent(tmp);
+            a_level.fillBndryNorm(tmp, m_geom);
+            r->addBndryNorm(tmp);
+        }
+        {
+            MultiFab tmp(m_ba, m_dm, 1, ng);
+            a_level.fillBndryArea(tmp, m_geom);
+            r->addBndryArea(tmp);
+        }
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
+        {
+            const BoxArray& faceba = amrex::convert(m_ba, IntVect::TheDimensionVector(idim));
+            {
+                MultiFab tmp(faceba, m_dm, 1, ng);
+                a_level.fillAreaFrac(tmp, idim, m_geom);
+                r->addAreaFrac(tmp, idim);
+            }
+            {
+                MultiFab tmp(faceba, m_dm, AMREX_SPACEDIM-1, ng);
+                a_level.fillFaceCent(tmp, idim, m_geom);
+                r->addFaceCent(tmp, idim);
+            }
+        }
+    }
+
+    return r;
+}
+
+void
+EBDataCollection::deleteDense ()
+{
     delete m_centroid;
     delete m_bndrycent;
     delete m_bndrynorm;
     delete m_bndryarea;
+    m_centroid = m_bndrycent = m_bndrynorm = m_bndryarea = nullptr;
     for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
         delete m_areafrac[idim];
         delete m_facecent[idim];
+        m_areafrac[idim] = m_facecent[idim] = nullptr;
+    }
+    m_dense_built = 0;
+}
+
+void
+EBDataCollection::makeDense (DenseData which) const
+{
+    // Without EBSupport::full, only the centroid is available.
+    if (!m_sparse || (which != dense_centroid && m_support != EBSupport::full)) return;
+
+    int built;
+#ifdef _OPENMP
+#pragma omp atomic read
+#endif
+    built = m_dense_built;
+    if (built & which) return;
+
+#ifdef _OPENMP
+#pragma omp critical (amrex_ebdc_dense)
+#endif
+    if (!(m_dense_built & which))
+    {
+        BL_PROFILE("EBDataCollection::makeDense()");
+
+        const int ng = (which == dense_centroid) ? m_ngrow[1] : m_ngrow[2];
+
+        if (which == dense_centroid) {
+            auto p = new MultiCutFab(m_ba, m_dm, AMREX_SPACEDIM, ng, *m_cellflags);
+            m_cutcelldata->fillCentroid(*p);
+            m_centroid = p;
+        } else if (which == dense_bndrycent) {
+            auto p = new MultiCutFab(m_ba, m_dm, AMREX_SPACEDIM, ng, *m_cellflags);
+            m_cutcelldata->fillBndryCent(*p);
+            m_bndrycent = p;
+        } else if (which == dense_bndryarea) {
+            auto p = new MultiCutFab(m_ba, m_dm, 1, ng, *m_cellflags);
+            m_cutcelldata->fillBndryArea(*p);
+            m_bndryarea = p;
+        } else if (which == dense_bndrynorm) {
+            auto p = new MultiCutFab(m_ba, m_dm, AMREX_SPACEDIM, ng, *m_cellflags);
+            m_cutcelldata->fillBndryNorm(*p);
+            m_bndrynorm = p;
+        } else {
+            Array<MultiCutFab*,AMREX_SPACEDIM> p;
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                const BoxArray& faceba = amrex::convert(m_ba, IntVect::TheDimensionVector(idim));
+                if (which == dense_areafrac) {
+                    p[idim] = new MultiCutFab(faceba, m_dm, 1, ng, *m_cellflags);
+                    m_cutcelldata->fillAreaFrac(*p[idim], idim);
+                } else {
+                    p[idim] = new MultiCutFab(faceba, m_dm, AMREX_SPACEDIM-1, ng, *m_cellflags);
+                    m_cutcelldata->fillFaceCent(*p[idim], idim);
+                }
+            }
+            if (which == dense_areafrac) {
+                m_areafrac = p;
+            } else {
+                m_facecent = p;
+            }
+        }
+
+        built = m_dense_built | which;
+#ifdef _OPENMP
+#pragma omp atomic write
+#endif
+        m_dense_built = built;
+    }
+}
+
+const MultiEBCutCellData&
+EBDataCollection::getCutCellData () const
+{
+    AMREX_ASSERT(m_support >= EBSupport::volume);
+
+    bool built;
+#ifdef _OPENMP
+#pragma omp atomic read
+#endif
+    built = m_cutcell_built;
+
+    if (!built)
+    {
+#ifdef _OPENMP
+#pragma omp critical (amrex_ebdc_sparse)
+#endif
+        if (m_cutcelldata == nullptr)
+        {
+            m_cutcelldata = buildCutCellData();
+#ifdef _OPENMP
+#pragma omp atomic write
+#endif
+            m_cutcell_built = true;
+        }
     }
+    return *m_cutcelldata;
 }
 
 const FabArray<EBCellFlagFab>&
@@ -90,6 +272,7 @@ EBDataCollection::getVolFrac () const
 const MultiCutFab&
 EBDataCollection::getCentroid () const
 {
+    makeDense(dense_centroid);
     AMREX_ASSERT(m_centroid != nullptr);
     return *m_centroid;
 }
@@ -97,6 +280,7 @@ EBDataCollection::getCentroid () const
 const MultiCutFab&
 EBDataCollection::getBndryCent () const
 {
+    makeDense(dense_bndrycent);
     AMREX_ASSERT(m_bndrycent != nullptr);
     return *m_bndrycent;
 }
@@ -104,6 +288,7 @@ EBDataCollection::getBndryCent () const
 const MultiCutFab&
 EBDataCollection::getBndryArea () const
 {
+    makeDense(dense_bndryarea);
     AMREX_ASSERT(m_bndryarea != nullptr);
     return *m_bndryarea;
 }
@@ -111,6 +296,7 @@ EBDataCollection::getBndryArea () const
 Array<const MultiCutFab*, AMREX_SPACEDIM>
 EBDataCollection::getAreaFrac () const
 {
+    makeDense(dense_areafrac);
     AMREX_ASSERT(m_areafrac[0] != nullptr);
     return {AMREX_D_DECL(m_areafrac[0], m_areafrac[1], m_areafrac[2])};
 }
@@ -118,6 +304,7 @@ EBDataCollection::getAreaFrac () const
 Array<const MultiCutFab*, AMREX_SPACEDIM>
 EBDataCollection::getFaceCent () const
 {
+    makeDense(dense_facecent);
     AMREX_ASSERT(m_facecent[0] != nullptr);
     return {AMREX_D_DECL(m_facecent[0], m_facecent[1], m_facecent[2])};
 }
@@ -125,8 +312,80 @@ EBDataCollection::getFaceCent () const
 const MultiCutFab&
 EBDataCollection::getBndryNormal () const
 {
+    makeDense(dense_bndrynorm);
     AMREX_ASSERT(m_bndrynorm != nullptr);
     return *m_bndrynorm;
 }
 
+const EBDataCollection::TileTypes&
+EBDataCollection::tileTypes (const IntVect& ts) const
+{
+    AMREX_ASSERT(m_cellflags != nullptr);
+
+    TileTypes* r = nullptr;
+
+#ifdef _OPENMP
+#pragma omp critical(ebdc_tiletypes)
+#endif
+    {
+        for (auto const& p : m_tiletypes) {
+            if (p->tilesize == ts) {
+                r = p.get();
+                break;
+            }
+        }
+
+        if (r == nullptr)
+        {
+            r = new TileTypes;
+            r->tilesize = ts;
+
+            const FabArrayBase::TileArray& ta = *(m_cellflags->getTileArray(ts));
+            const int n = ta.indexMap.size();
+            r->types.resize(n);
+            for (auto& g : r->tiles) {
+                g.nuse = 0;
+            }
+
+            for (int i = 0; i < n; ++i)
+            {
+                const int K = ta.indexMap[i];
+                const FabType t = (*m_cellflags)[K].getType(ta.tileArray[i]);
+                r->types[i] = t;
+
+                const int g = (t == FabType::regular) ? 0 : ((t == FabType::covered) ? 1 : 2);
+                FabArrayBase::TileArray& gta = r->tiles[g];
+                gta.indexMap.push_back(K);
+                gta.localIndexMap.push_back(ta.localIndexMap[i]);
+                gta.localTileIndexMap.push_back(ta.localTileIndexMap[i]);
+                gta.numLocalTiles.push_back(ta.numLocalTiles[i]);
+                gta.tileArray.push_back(ta.tileArray[i]);
+            }
+
+            m_tiletypes.emplace_back(r);
+        }
+    }
+
+    return *r;
+}
+
+const Vector<FabType>&
+EBDataCollection::getTileTypes (const IntVect& ts) const
+{
+    return tileTypes(ts).types;
+}
+
+const FabArrayBase::TileArray*
+EBDataCollection::getTiles (const IntVect& ts, FabType t) const
+{
+    const TileTypes& tt = tileTypes(ts);
+    if (t == FabType::regular) {
+        return &tt.tiles[0];
+    } else if (t == FabType::covered) {
+        return &tt.tiles[1];
+    } else {
+        return &tt.tiles[2];
+    }
+}
+
 }
@@ -4,9 +4,12 @@
 #include <AMReX_EBFArrayBox.H>
 #include <AMReX_EBCellFlag.H>
 #include <AMReX_FabArray.H>
+#include <AMReX_MultiCutFab.H>
+#include <AMReX_EBCutCellData.H>
 
 #include <AMReX_EB2_Level.H>
 #include <AMReX_EB2.H>
+#include <AMReX_EBAmrUtil.H>
 
 namespace amrex
 {
@@ -92,14 +95,62 @@ EBFArrayBoxFactory::getEBIndexSpace () const
     return (m_parent) ? m_parent->getEBIndexSpace() : nullptr;
 }
 
+const FArrayBox&
+EBFArrayBoxFactory::bndryCentFab (const MFIter& mfi, const Box& bx, FArrayBox& tmp) const
+{
+    if (sparseStorage()) {
+        tmp.resize(bx, AMREX_SPACEDIM);
+        getCutCellData().fillBndryCent(tmp, mfi);
+        return tmp;
+    } else {
+        return getBndryCent()[mfi];
+    }
+}
+
+const FArrayBox&
+EBFArrayBoxFactory::bndryAreaFab (const MFIter& mfi, const Box& bx, FArrayBox& tmp) const
+{
+    if (sparseStorage()) {
+        tmp.resize(bx, 1);
+        getCutCellData().fillBndryArea(tmp, mfi);
+        return tmp;
+    } else {
+        return getBndryArea()[mfi];
+    }
+}
+
+const FArrayBox&
+EBFArrayBoxFactory::areaFracFab (const MFIter& mfi, int dir, const Box& bx, FArrayBox& tmp) const
+{
+    if (sparseStorage()) {
+        tmp.resize(bx, 1);
+        getCutCellData().fillAreaFrac(tmp, mfi, dir);
+        return tmp;
+    } else {
+        return (*getAreaFrac()[dir])[mfi];
+    }
+}
+
+const FArrayBox&
+EBFArrayBoxFactory::faceCentFab (const MFIter& mfi, int dir, const Box& bx, FArrayBox& tmp) const
+{
+    if (sparseStorage()) {
+        tmp.resize(bx, AMREX_SPACEDIM-1);
+        getCutCellData().fillFaceCent(tmp, mfi, dir);
+        return tmp;
+    } else {
+        return (*getFaceCent()[dir])[mfi];
+    }
+}
+
 int
-EBFArrayBoxFactory::maxCoarseningLevel () const
+EBFArrayBoxFactory::maxCoarseningLevel (int max_level) const
 {
     if (m_parent) {
         EB2::IndexSpace const* ebis = m_parent->getEBIndexSpace();
-        return EB2::maxCoarseningLevel(ebis, m_geom);
+        return EB2::maxCoarseningLevel(ebis, m_geom, max_level);
     } else {
-        return EB2::maxCoarseningLevel(m_geom);
+        return EB2::maxCoarseningLevel(m_geom, max_level);
     }
 }
 
@@ -128,6 +179,16 @@ makeEBFabFactory (const Geometry& a_geom,
     return r;
 }
 
+std::unique_ptr<EBFArrayBoxFactory>
+makeEBFabFactory (const Geometry& a_geom,
+                  const BoxArray& a_ba,
+                  const Vector<int>& a_ngrow, EBSupport a_support)
+{
+    const DistributionMapping& dm = EB2::load_balance
+        ? EBDistributionMapping(a_ba, a_geom) : DistributionMapping(a_ba);
+    return makeEBFabFactory(a_geom, a_ba, dm, a_ngrow, a_support);
+}
+
 std::unique_ptr<EBFArrayBoxFactory>
 makeEBFabFactory (const EB2::Level* eb_level,
                   const BoxArray& a_ba,
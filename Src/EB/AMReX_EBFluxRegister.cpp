@@ -2,6 +2,7 @@
 #include <AMReX_EBFluxRegister.H>
 #include <AMReX_EBFluxRegister_F.H>
 #include <AMReX_EBFArrayBox.H>
+#include <AMReX_BoxIterator.H>
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -52,6 +53,10 @@ EBFluxRegister::defineExtra (const BoxArray& fba, const DistributionMapping& fdm
             ifab.setVal(1,ibx);  // cells just inside crse/fine boundary
         }
     }
+
+    m_has_stencil = false;
+    m_crse_stencil.clear();
+    m_fine_stencil.clear();
 }
 
 void
@@ -191,10 +196,117 @@ EBFluxRegister::FineAdd (const MFIter& mfi,
 }
 
 
+void
+EBFluxRegister::buildStencil (const MultiFab& crse_state, const MultiFab& crse_vfrac,
+                              const MultiFab& fine_state)
+{
+    BL_PROFILE("EBFluxRegister::buildStencil()");
+
+    {
+        auto const& factory = dynamic_cast<EBFArrayBoxFactory const&>(crse_state.Factory());
+        auto const& flags = factory.getMultiEBCellFlagFab();
+
+        m_crse_stencil.clear();
+        m_crse_stencil.resize(m_crse_data.local_size());
+
+        const Box nbrs(IntVect(-1), IntVect(1));
+
+        // The tiles are the same as those of the dense version, so the
+        // results are the same.
+        for (MFIter mfi(m_crse_data, MFItInfo().EnableTiling()); mfi.isValid(); ++mfi)
+        {
+            if (m_crse_fab_flag[mfi.LocalIndex()] != fine_cell) continue;
+
+            const Box& bx = mfi.tilebox();
+            const auto& ebflag = flags[mfi];
+            if (ebflag.getType(bx) == FabType::covered) continue;
+
+            CrseStencil& st = m_crse_stencil[mfi.LocalIndex()];
+            if (ebflag.getType(amrex::grow(bx,1)) == FabType::regular)
+            {
+                st.regular.push_back(bx);
+                continue;
+            }
+
+            const Box& dbox = m_crse_data[mfi].box();
+            const Box& sbox = amrex::grow(mfi.validbox(),1);
+            const IArrayBox& amrflag = m_crse_flag[mfi];
+            const FArrayBox& vfrac = crse_vfrac[mfi];
+
+            auto add = [&] (const IntVect& d, const IntVect& s, Real w0, Real w1) {
+                st.dst.push_back(dbox.index(d));
+                st.src.push_back(sbox.index(s));
+                st.w0.push_back(w0);
+                st.w1.push_back(w1);
+            };
+
+            for (BoxIterator bi(amrex::grow(bx,1)); bi.ok(); ++bi)
+            {
+                const IntVect& iv = bi();
+                if (amrflag(iv) != crse_fine_boundary_cell) continue;
+
+                const EBCellFlag& flag = ebflag(iv);
+                if (flag.isRegular())
+                {
+                    if (bx.contains(iv)) add(iv, iv, 1.0, 1.0);
+                }
+                else if (flag.isSingleValued())
+                {
+                    const Real vf = vfrac(iv);
+                    if (bx.contains(iv)) add(iv, iv, vf, 1.0);
+
+                    Real wtot = 0.0;
+                    for (BoxIterator ni(nbrs); ni.ok(); ++ni) {
+                        if (ni() != IntVect::TheZeroVector() && flag.isConnected(ni())) {
+                            wtot += vfrac(iv+ni());
+                        }
+                    }
+
+                    for (BoxIterator ni(nbrs); ni.ok(); ++ni) {
+                        const IntVect& nv = iv + ni();
+                        if (ni() != IntVect::TheZeroVector() && flag.isConnected(ni())
+                            && bx.contains(nv))
+                        {
+                            add(nv, iv, vf, (1.0-vf)/wtot);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    {
+        auto const& factory = dynamic_cast<EBFArrayBoxFactory const&>(fine_state.Factory());
+        auto const& flags = factory.getMultiEBCellFlagFab();
+
+        m_fine_stencil.clear();
+        m_fine_stencil.resize(m_cfp_inside_mask.local_size());
+
+        for (MFIter mfi(m_cfp_inside_mask,true); mfi.isValid(); ++mfi)
+        {
+            const Box& cbx = mfi.tilebox();
+            const Box& fbx = amrex::refine(cbx, m_ratio);
+            if (flags[mfi].getType(fbx) == FabType::covered) continue;
+
+            const IArrayBox& msk = m_cfp_inside_mask[mfi];
+            auto& cells = m_fine_stencil[mfi.LocalIndex()];
+            for (BoxIterator bi(cbx); bi.ok(); ++bi) {
+                if (msk(bi()) == 1) cells.push_back(bi());
+            }
+        }
+    }
+
+    m_has_stencil = true;
+}
+
 void
 EBFluxRegister::Reflux (MultiFab& crse_state, const amrex::MultiFab& crse_vfrac,
                         MultiFab& fine_state, const amrex::MultiFab& fine_vfrac)
 {
+    if (!m_has_stencil) {
+        buildStencil(crse_state, crse_vfrac, fine_state);
+    }
+
     if (!m_cfp_mask.empty())
     {
 #ifdef _OPENMP
@@ -217,44 +329,28 @@ EBFluxRegister::Reflux (MultiFab& crse_state, const amrex::MultiFab& crse_vfrac,
         grown_crse_data.FillBoundary(m_crse_geom.periodicity());
         
         m_crse_data.setVal(0.0);
-        
-        auto const& factory = dynamic_cast<EBFArrayBoxFactory const&>(crse_state.Factory());
-        auto const& flags = factory.getMultiEBCellFlagFab();
 
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
+        for (MFIter mfi(m_crse_data, MFItInfo().SetDynamic(true)); mfi.isValid(); ++mfi)
         {
-            FArrayBox fab;
-            for (MFIter mfi(m_crse_data, MFItInfo().EnableTiling().SetDynamic(true));
-                 mfi.isValid(); ++mfi)
+            const CrseStencil& st = m_crse_stencil[mfi.LocalIndex()];
+            FArrayBox& dfab = m_crse_data[mfi];
+            const FArrayBox& sfab = grown_crse_data[mfi];
+
+            for (const Box& bx : st.regular) {
+                // no re-reflux or re-re-redistribution
+                dfab.plus(sfab,bx,0,0,m_ncomp);
+            }
+
+            const int ne = st.dst.size();
+            for (int n = 0; n < m_ncomp; ++n)
             {
-                if (m_crse_fab_flag[mfi.LocalIndex()] == fine_cell) // fab has crse/fine cells
-                {
-                    const Box& bx = mfi.tilebox();
-                    
-                    const auto& ebflag = flags[mfi];
-                    
-                    if (ebflag.getType(bx) != FabType::covered) {
-                        if (ebflag.getType(amrex::grow(bx,1)) == FabType::regular)
-                        {
-                            // no re-reflux or re-re-redistribution
-                            m_crse_data[mfi].plus(grown_crse_data[mfi],bx,0,0,m_ncomp);
-                        }
-                        else
-                        {
-                            fab.resize(amrex::grow(bx,2),m_ncomp);
-                            fab.setVal(0.0);
-                            amrex_eb_rereflux_from_crse(BL_TO_FORTRAN_BOX(bx),
-                                                        BL_TO_FORTRAN_ANYD(fab),
-                                                        BL_TO_FORTRAN_ANYD(grown_crse_data[mfi]),
-                                                        BL_TO_FORTRAN_ANYD(m_crse_flag[mfi]),
-                                                        BL_TO_FORTRAN_ANYD(ebflag),
-                                                        BL_TO_FORTRAN_ANYD(crse_vfrac[mfi]),
-                                                        &m_ncomp);
-                            m_crse_data[mfi].plus(fab,bx,0,0,m_ncomp);
-                        }
-                    }
+                Real* AMREX_RESTRICT d = dfab.dataPtr(n);
+                const Real* AMREX_RESTRICT src = sfab.dataPtr(n);
+                for (int e = 0; e < ne; ++e) {
+                    d[st.dst[e]] += (src[st.src[e]]*st.w0[e])*st.w1[e];
                 }
             }
         }
@@ -268,26 +364,20 @@ EBFluxRegister::Reflux (MultiFab& crse_state, const amrex::MultiFab& crse_vfrac,
     MultiFab cf(ba, fine_state.DistributionMap(), m_ncomp, 0, MFInfo(), FArrayBoxFactory());
     cf.ParallelCopy(m_crse_data);
 
-    auto const& factory = dynamic_cast<EBFArrayBoxFactory const&>(fine_state.Factory());
-    auto const& flags = factory.getMultiEBCellFlagFab();
-
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
-    for (MFIter mfi(cf,true); mfi.isValid(); ++mfi)
+    for (MFIter mfi(cf, MFItInfo().SetDynamic(true)); mfi.isValid(); ++mfi)
     {
-        const Box& cbx = mfi.tilebox();
-        const Box& fbx = amrex::refine(cbx, m_ratio);
-        
-        const auto& ebflag = flags[mfi];
-        
-        if (ebflag.getType(fbx) != FabType::covered)
+        FArrayBox& ffab = fine_state[mfi];
+        const FArrayBox& cfab = cf[mfi];
+        // Cells next to the crse/fine boundary
+        for (const IntVect& iv : m_fine_stencil[mfi.LocalIndex()])
         {
-            amrex_eb_rereflux_to_fine(BL_TO_FORTRAN_BOX(cbx),
-                                      BL_TO_FORTRAN_ANYD(fine_state[mfi]),
-                                      BL_TO_FORTRAN_ANYD(cf[mfi]),
-                                      BL_TO_FORTRAN_ANYD(m_cfp_inside_mask[mfi]),
-                                      &m_ncomp, m_ratio.getVect());
+            const Box& fbx = amrex::refine(Box(iv,iv), m_ratio);
+            for (int n = 0; n < m_ncomp; ++n) {
+                ffab.plus(cfab(iv,n), fbx, n, 1);
+            }
         }
     }
 }
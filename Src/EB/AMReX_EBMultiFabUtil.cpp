@@ -27,6 +27,43 @@ EB_set_covered (MultiFab& mf, int icomp, int ncomp, const Vector<Real>& vals)
 {
     AMREX_ALWAYS_ASSERT(mf.ixType().cellCentered() || mf.ixType().nodeCentered());
     bool is_cell_centered = mf.ixType().cellCentered();
+
+    const auto factory = dynamic_cast<EBFArrayBoxFactory const*>(&(mf.Factory()));
+    if (factory)
+    {
+        // Regular tiles have nothing to set.
+        const IntVect& ts = FabArrayBase::mfiter_tile_size;
+        for (FabType t : {FabType::covered, FabType::singlevalued})
+        {
+            MFItInfo info;
+            info.EnableTiling(ts).SetTiles(factory->getTiles(ts, t));
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+            for (MFIter mfi(mf,info); mfi.isValid(); ++mfi)
+            {
+                const Box& bx = mfi.tilebox();
+                FArrayBox& fab = mf[mfi];
+                if (is_cell_centered && t == FabType::covered) {
+                    for (int n = 0; n < ncomp; ++n) {
+                        fab.setVal(vals[n], bx, icomp+n, 1);
+                    }
+                } else if (is_cell_centered) {
+                    amrex_eb_set_covered(BL_TO_FORTRAN_BOX(bx),
+                                         BL_TO_FORTRAN_N_ANYD(fab,icomp),
+                                         BL_TO_FORTRAN_ANYD(factory->getMultiEBCellFlagFab()[mfi]),
+                                         vals.data(),&ncomp);
+                } else {
+                    amrex_eb_set_covered_nodes(BL_TO_FORTRAN_BOX(bx),
+                                               BL_TO_FORTRAN_N_ANYD(fab,icomp),
+                                               BL_TO_FORTRAN_ANYD(factory->getMultiEBCellFlagFab()[mfi]),
+                                               vals.data(),&ncomp);
+                }
+            }
+        }
+        return;
+    }
+
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
@@ -55,24 +92,27 @@ EB_set_covered_faces (const Array<MultiFab*,AMREX_SPACEDIM>& umac, Real val)
     const auto factory = dynamic_cast<EBFArrayBoxFactory const*>(&(umac[0]->Factory()));
     if (factory == nullptr) return;
 
-    const auto& area = factory->getAreaFrac();
     const auto& flags = factory->getMultiEBCellFlagFab();
 
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
-    for (MFIter mfi(*umac[0],true); mfi.isValid(); ++mfi)
     {
-        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
+        FArrayBox areatmp;
+        for (MFIter mfi(*umac[0],true); mfi.isValid(); ++mfi)
         {
-            const Box& bx = mfi.tilebox(IntVect::TheDimensionVector(idim));
-            auto fabtyp = flags[mfi].getType(amrex::enclosedCells(bx));
-            if (fabtyp == FabType::covered) {
-                (*umac[idim])[mfi].setVal(0.0, bx, 0, 1);
-            } else if (fabtyp != FabType::regular) {
-                amrex_eb_set_covered_faces(BL_TO_FORTRAN_BOX(bx),
-                                           BL_TO_FORTRAN_ANYD((*umac[idim])[mfi]),
-                                           BL_TO_FORTRAN_ANYD((*area[idim])[mfi]));
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
+            {
+                const Box& bx = mfi.tilebox(IntVect::TheDimensionVector(idim));
+                auto fabtyp = flags[mfi].getType(amrex::enclosedCells(bx));
+                if (fabtyp == FabType::covered) {
+                    (*umac[idim])[mfi].setVal(0.0, bx, 0, 1);
+                } else if (fabtyp != FabType::regular) {
+                    const FArrayBox& area = factory->areaFracFab(mfi, idim, bx, areatmp);
+                    amrex_eb_set_covered_faces(BL_TO_FORTRAN_BOX(bx),
+                                               BL_TO_FORTRAN_ANYD((*umac[idim])[mfi]),
+                                               BL_TO_FORTRAN_ANYD(area));
+                }
             }
         }
     }
@@ -252,31 +292,35 @@ void EB_average_down_faces (const Array<const MultiFab*,AMREX_SPACEDIM>& fine,
     else 
     {
         const auto& factory = dynamic_cast<EBFArrayBoxFactory const&>((*fine[0]).Factory());
-        const auto&  aspect = factory.getAreaFrac();
 
         if (isMFIterSafe(*fine[0], *crse[0]))
         {
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
-            for (int n=0; n<AMREX_SPACEDIM; ++n) {
-                for (MFIter mfi(*crse[n],true); mfi.isValid(); ++mfi)
-                {
-                    const auto& flag_fab = amrex::getEBCellFlagFab((*fine[n])[mfi]);
-                    const Box& tbx = mfi.growntilebox(ngcrse);
-                    FabType typ = flag_fab.getType(amrex::refine(tbx,ratio));
-               
-                    if(typ == FabType::regular || typ == FabType::covered) 
-                    {    
-                        amrex_avgdown_faces(tbx, (*crse[n])[mfi], (*fine[n])[mfi], 0, 0, ncomp, ratio, n);
-                    }
-                    else
+            {
+                FArrayBox areatmp;
+                for (int n=0; n<AMREX_SPACEDIM; ++n) {
+                    for (MFIter mfi(*crse[n],true); mfi.isValid(); ++mfi)
                     {
-                       amrex_eb_avgdown_faces(tbx.loVect(), tbx.hiVect(), 
-                                              BL_TO_FORTRAN_ANYD((*fine[n])[mfi]), 
-                                              BL_TO_FORTRAN_ANYD((*crse[n])[mfi]),
-                                              BL_TO_FORTRAN_ANYD((*aspect[n])[mfi]),
-                                              ratio.getVect(), &n, &ncomp);
+                        const auto& flag_fab = amrex::getEBCellFlagFab((*fine[n])[mfi]);
+                        const Box& tbx = mfi.growntilebox(ngcrse);
+                        FabType typ = flag_fab.getType(amrex::refine(tbx,ratio));
+               
+                        if(typ == FabType::regular || typ == FabType::covered) 
+                        {    
+                            amrex_avgdown_faces(tbx, (*crse[n])[mfi], (*fine[n])[mfi], 0, 0, ncomp, ratio, n);
+                        }
+                        else
+                        {
+                           const FArrayBox& aspect = factory.areaFracFab(mfi, n,
+                                                                    amrex::refine(tbx,ratio), areatmp);
+                           amrex_eb_avgdown_faces(tbx.loVect(), tbx.hiVect(), 
+                                                  BL_TO_FORTRAN_ANYD((*fine[n])[mfi]), 
+                                                  BL_TO_FORTRAN_ANYD((*crse[n])[mfi]),
+                                                  BL_TO_FORTRAN_ANYD(aspect),
+                                                  ratio.getVect(), &n, &ncomp);
+                        }
                     }
                 }
             }
@@ -318,26 +362,30 @@ void EB_average_down_boundaries (const MultiFab& fine, MultiFab& crse,
     {
         const auto& factory = dynamic_cast<EBFArrayBoxFactory const&>(fine.Factory());
         const auto& flags = factory.getMultiEBCellFlagFab();
-        const auto& barea = factory.getBndryArea();
 
         if (isMFIterSafe(fine, crse))
         {
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
-            for (MFIter mfi(crse, MFItInfo().EnableTiling().SetDynamic(true)); mfi.isValid(); ++mfi)
             {
-                const Box& tbx = mfi.growntilebox(ngcrse);
-                FabType typ = flags[mfi].getType(amrex::refine(tbx,ratio));
-
-                if (FabType::covered == typ || FabType::regular == typ) {
-                    crse[mfi].setVal(0.0, tbx, 0, 1);
-                } else {
-                    amrex_eb_avgdown_boundaries(tbx.loVect(), tbx.hiVect(),
-                                                BL_TO_FORTRAN_ANYD(fine[mfi]),
-                                                BL_TO_FORTRAN_ANYD(crse[mfi]),
-                                                BL_TO_FORTRAN_ANYD(barea[mfi]),
-                                                ratio.getVect(), &ncomp);
+                FArrayBox bareatmp;
+                for (MFIter mfi(crse, MFItInfo().EnableTiling().SetDynamic(true)); mfi.isValid(); ++mfi)
+                {
+                    const Box& tbx = mfi.growntilebox(ngcrse);
+                    FabType typ = flags[mfi].getType(amrex::refine(tbx,ratio));
+
+                    if (FabType::covered == typ || FabType::regular == typ) {
+                        crse[mfi].setVal(0.0, tbx, 0, 1);
+                    } else {
+                        const FArrayBox& barea = factory.bndryAreaFab(mfi, amrex::refine(tbx,ratio),
+                                                                      bareatmp);
+                        amrex_eb_avgdown_boundaries(tbx.loVect(), tbx.hiVect(),
+                                                    BL_TO_FORTRAN_ANYD(fine[mfi]),
+                                                    BL_TO_FORTRAN_ANYD(crse[mfi]),
+                                                    BL_TO_FORTRAN_ANYD(barea),
+                                                    ratio.getVect(), &ncomp);
+                    }
                 }
             }
         }
@@ -365,8 +413,6 @@ void EB_computeDivergence (MultiFab& divu, const Array<MultiFab const*,AMREX_SPA
         const auto& factory = dynamic_cast<EBFArrayBoxFactory const&>(divu.Factory());
         const auto& flags = factory.getMultiEBCellFlagFab();
         const auto& vfrac = factory.getVolFrac();
-        const auto& area = factory.getAreaFrac();
-        const auto& fcent = factory.getFaceCent();
 
         iMultiFab cc_mask(divu.boxArray(), divu.DistributionMap(), 1, 1);
         cc_mask.setVal(0);
@@ -397,36 +443,45 @@ void EB_computeDivergence (MultiFab& divu, const Array<MultiFab const*,AMREX_SPA
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
-        for (MFIter mfi(divu,MFItInfo().EnableTiling().SetDynamic(true)); mfi.isValid(); ++mfi)
         {
-            const Box& bx = mfi.tilebox();
-            const auto& flagfab = flags[mfi];
-            auto& divufab = divu[mfi];
-            AMREX_D_TERM(const FArrayBox& ufab = (*umac[0])[mfi];,
-                         const FArrayBox& vfab = (*umac[1])[mfi];,
-                         const FArrayBox& wfab = (*umac[2])[mfi];);
-
-            const auto fabtyp = flagfab.getType(bx);
-            if (fabtyp == FabType::covered) {
-                divufab.setVal(0.0, bx, 0, 1);
-            } else if (fabtyp == FabType::regular) {
-                amrex_compute_divergence(bx,divufab,AMREX_D_DECL(ufab,vfab,wfab),dxinv);
-            } else {
-                amrex_compute_eb_divergence(BL_TO_FORTRAN_BOX(bx),
-                                            BL_TO_FORTRAN_ANYD(divufab),
-                                            AMREX_D_DECL(BL_TO_FORTRAN_ANYD(ufab),
-                                                         BL_TO_FORTRAN_ANYD(vfab),
-                                                         BL_TO_FORTRAN_ANYD(wfab)),
-                                            BL_TO_FORTRAN_ANYD(cc_mask[mfi]),
-                                            BL_TO_FORTRAN_ANYD(flagfab),
-                                            BL_TO_FORTRAN_ANYD(vfrac[mfi]),
-                                            AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*area[0])[mfi]),
-                                                         BL_TO_FORTRAN_ANYD((*area[1])[mfi]),
-                                                         BL_TO_FORTRAN_ANYD((*area[2])[mfi])),
-                                            AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*fcent[0])[mfi]),
-                                                         BL_TO_FORTRAN_ANYD((*fcent[1])[mfi]),
-                                                         BL_TO_FORTRAN_ANYD((*fcent[2])[mfi])),
-                                            dxinv.data());
+            Array<FArrayBox,AMREX_SPACEDIM> areatmp, fcenttmp;
+            for (MFIter mfi(divu,MFItInfo().EnableTiling().SetDynamic(true)); mfi.isValid(); ++mfi)
+            {
+                const Box& bx = mfi.tilebox();
+                const auto& flagfab = flags[mfi];
+                auto& divufab = divu[mfi];
+                AMREX_D_TERM(const FArrayBox& ufab = (*umac[0])[mfi];,
+                             const FArrayBox& vfab = (*umac[1])[mfi];,
+                             const FArrayBox& wfab = (*umac[2])[mfi];);
+
+                const auto fabtyp = flagfab.getType(bx);
+                if (fabtyp == FabType::covered) {
+                    divufab.setVal(0.0, bx, 0, 1);
+                } else if (fabtyp == FabType::regular) {
+                    amrex_compute_divergence(bx,divufab,AMREX_D_DECL(ufab,vfab,wfab),dxinv);
+                } else {
+                    Array<const FArrayBox*,AMREX_SPACEDIM> area, fcent;
+                    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                        const Box& fbx = amrex::surroundingNodes(bx,idim);
+                        area[idim] = &factory.areaFracFab(mfi, idim, fbx, areatmp[idim]);
+                        fcent[idim] = &factory.faceCentFab(mfi, idim, fbx, fcenttmp[idim]);
+                    }
+                    amrex_compute_eb_divergence(BL_TO_FORTRAN_BOX(bx),
+                                                BL_TO_FORTRAN_ANYD(divufab),
+                                                AMREX_D_DECL(BL_TO_FORTRAN_ANYD(ufab),
+                                                             BL_TO_FORTRAN_ANYD(vfab),
+                                                             BL_TO_FORTRAN_ANYD(wfab)),
+                                                BL_TO_FORTRAN_ANYD(cc_mask[mfi]),
+                                                BL_TO_FORTRAN_ANYD(flagfab),
+                                                BL_TO_FORTRAN_ANYD(vfrac[mfi]),
+                                                AMREX_D_DECL(BL_TO_FORTRAN_ANYD(*area[0]),
+                                                             BL_TO_FORTRAN_ANYD(*area[1]),
+                                                             BL_TO_FORTRAN_ANYD(*area[2])),
+                                                AMREX_D_DECL(BL_TO_FORTRAN_ANYD(*fcent[0]),
+                                                             BL_TO_FORTRAN_ANYD(*fcent[1]),
+                                                             BL_TO_FORTRAN_ANYD(*fcent[2])),
+                                                dxinv.data());
+                }
             }
         }
     }
@@ -446,34 +501,41 @@ EB_average_face_to_cellcenter (MultiFab& ccmf, int dcomp,
     {
         const auto& factory = dynamic_cast<EBFArrayBoxFactory const&>(fmf[0]->Factory());
         const auto& flags = factory.getMultiEBCellFlagFab();
-        const auto& area = factory.getAreaFrac();
 
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
-        for (MFIter mfi(ccmf,MFItInfo().EnableTiling().SetDynamic(true)); mfi.isValid(); ++mfi)
         {
-            const Box& bx = mfi.tilebox();
-            const auto& flagfab = flags[mfi];
-            auto& ccfab = ccmf[mfi];
-            AMREX_D_TERM(const auto& xfab = (*fmf[0])[mfi];,
-                         const auto& yfab = (*fmf[1])[mfi];,
-                         const auto& zfab = (*fmf[2])[mfi];);
-            const auto fabtyp = flagfab.getType(bx);
-            if (fabtyp == FabType::covered) {
-                ccfab.setVal(0.0, bx, dcomp, 1);
-            } else if (fabtyp == FabType::regular) {
-                amrex_avg_fc_to_cc(bx,ccfab,AMREX_D_DECL(xfab,yfab,zfab),dcomp);
-            } else {
-                amrex_eb_avg_fc_to_cc(BL_TO_FORTRAN_BOX(bx),
-                                      BL_TO_FORTRAN_N_ANYD(ccfab,dcomp),
-                                      AMREX_D_DECL(BL_TO_FORTRAN_ANYD(xfab),
-                                                   BL_TO_FORTRAN_ANYD(yfab),
-                                                   BL_TO_FORTRAN_ANYD(zfab)),
-                                      AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*area[0])[mfi]),
-                                                   BL_TO_FORTRAN_ANYD((*area[1])[mfi]),
-                                                   BL_TO_FORTRAN_ANYD((*area[2])[mfi])),
-                                      BL_TO_FORTRAN_ANYD(flagfab));
+            Array<FArrayBox,AMREX_SPACEDIM> areatmp;
+            for (MFIter mfi(ccmf,MFItInfo().EnableTiling().SetDynamic(true)); mfi.isValid(); ++mfi)
+            {
+                const Box& bx = mfi.tilebox();
+                const auto& flagfab = flags[mfi];
+                auto& ccfab = ccmf[mfi];
+                AMREX_D_TERM(const auto& xfab = (*fmf[0])[mfi];,
+                             const auto& yfab = (*fmf[1])[mfi];,
+                             const auto& zfab = (*fmf[2])[mfi];);
+                const auto fabtyp = flagfab.getType(bx);
+                if (fabtyp == FabType::covered) {
+                    ccfab.setVal(0.0, bx, dcomp, 1);
+                } else if (fabtyp == FabType::regular) {
+                    amrex_avg_fc_to_cc(bx,ccfab,AMREX_D_DECL(xfab,yfab,zfab),dcomp);
+                } else {
+                    Array<const FArrayBox*,AMREX_SPACEDIM> area;
+                    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                        area[idim] = &factory.areaFracFab(mfi, idim,
+                                                         amrex::surroundingNodes(bx,idim), areatmp[idim]);
+                    }
+                    amrex_eb_avg_fc_to_cc(BL_TO_FORTRAN_BOX(bx),
+                                          BL_TO_FORTRAN_N_ANYD(ccfab,dcomp),
+                                          AMREX_D_DECL(BL_TO_FORTRAN_ANYD(xfab),
+                                                       BL_TO_FORTRAN_ANYD(yfab),
+                                                       BL_TO_FORTRAN_ANYD(zfab)),
+                                          AMREX_D_DECL(BL_TO_FORTRAN_ANYD(*area[0]),
+                                                       BL_TO_FORTRAN_ANYD(*area[1]),
+                                                       BL_TO_FORTRAN_ANYD(*area[2])),
+                                          BL_TO_FORTRAN_ANYD(flagfab));
+                }
             }
         }
     }
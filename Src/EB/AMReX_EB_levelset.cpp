@@ -16,6 +16,8 @@
 
 #include <AMReX_EB2.H>
 
+#include <cmath>
+
 namespace amrex {
 
 LSFactory::LSFactory(int lev, int ls_ref, int eb_ref, int ls_pad, int eb_pad,
@@ -192,6 +194,52 @@ void LSFactory::fill_valid(){
 
     fill_valid(ls_grid_pad);
 
+    fill_valid_bcs();
+}
+
+
+
+void LSFactory::fill_valid(const Vector<Vector<Box>> & updated){
+
+    BL_PROFILE("LSFactory::fill_valid(updated)");
+
+    // Valid tags are only ever set (never cleared), and they only depend on
+    // the level-set within search_radius => a tile needs to be visited only
+    // if it is within search_radius of an updated tile.
+    int search_radius = 1;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for(MFIter mfi( * ls_grid, true); mfi.isValid(); ++ mfi) {
+        Box tile_box = mfi.tilebox();
+        const Box search_box = amrex::grow(tile_box, search_radius);
+
+        bool near_update = false;
+        for (const Box & bx : updated[mfi.LocalIndex()]) {
+            if (bx.intersects(search_box)) {
+                near_update = true;
+                break;
+            }
+        }
+        if (! near_update) continue;
+
+        const auto & ls_tile = (* ls_grid)[mfi];
+        auto & valid_tile    = (* ls_valid)[mfi];
+
+        amrex_eb_fill_valid(tile_box.loVect(), tile_box.hiVect(),
+                            BL_TO_FORTRAN_3D(valid_tile),
+                            BL_TO_FORTRAN_3D(ls_tile),
+                            & search_radius);
+    }
+
+    fill_valid_bcs();
+}
+
+
+
+void LSFactory::fill_valid_bcs(){
+
    /****************************************************************************
     * Set boundary values of valid_grid                                        *
     ****************************************************************************/
@@ -232,7 +280,7 @@ void LSFactory::fill_valid(){
 
 
 std::unique_ptr<Vector<Real>> LSFactory::eb_facets(const FArrayBox & norm_tile,
-                                                   const CutFab & bcent_tile,
+                                                   const FArrayBox & bcent_tile,
                                                    const EBCellFlagFab & flag_tile,
                                                    const RealVect & dx_eb,
                                                    const Box & eb_search)
@@ -586,7 +634,8 @@ void LSFactory::fill_data (MultiFab & data, iMultiFab & valid,
      *                                                                          *
      ***************************************************************************/
 
-    const MultiCutFab & bndrycent = eb_factory.getBndryCent();
+    // With sparse storage, the boundary centroids of a tile are filled in a
+    // temporary (see EBFArrayBoxFactory::bndryCentFab)
     const auto & flags = eb_factory.getMultiEBCellFlagFab();
 
     // make sure to use the EB-factory's ngrow for the eb-padding;
@@ -646,7 +695,7 @@ void LSFactory::fill_data (MultiFab & data, iMultiFab & valid,
 
         //_______________________________________________________________________
         // Don't do anything for the current tile if EB facets are ill-defined
-        if (! bndrycent.ok(mfi)){
+        if (flags[mfi].getType() != FabType::singlevalued){
             auto & ls_tile = data[mfi];
             ls_tile.setVal( min_dx *( eb_pad + 1), tile_box );
 
@@ -680,7 +729,8 @@ void LSFactory::fill_data (MultiFab & data, iMultiFab & valid,
         const auto & flag       = flags[mfi];
         const auto & if_tile    = eb_impfunc[mfi];
         const auto & norm_tile  = normal[mfi];
-        const auto & bcent_tile = bndrycent[mfi];
+        FArrayBox bcent_tmp;
+        const auto & bcent_tile = eb_factory.bndryCentFab(mfi, eb_search, bcent_tmp);
 
         auto & v_tile      = eb_valid[mfi];
         auto & ls_tile     = data[mfi];
@@ -945,6 +995,191 @@ std::unique_ptr<iMultiFab> LSFactory::Fill(const MultiFab & mf_impfunc,
 
 
 
+std::unique_ptr<iMultiFab> LSFactory::Update(const EBFArrayBoxFactory & eb_factory,
+                                             const MultiFab & mf_impfunc,
+                                             int band) {
+    return Update(eb_factory, mf_impfunc,
+                  IntVect{AMREX_D_DECL(eb_tile_size, eb_tile_size, eb_tile_size)}, band);
+}
+
+
+
+std::unique_ptr<iMultiFab> LSFactory::Update(const EBFArrayBoxFactory & eb_factory,
+                                             const MultiFab & mf_impfunc,
+                                             const IntVect & ebt_size, int band) {
+
+    BL_PROFILE("LSFactory::Update()");
+
+    /****************************************************************************
+     *                                                                          *
+     * Returns: iMultiFab indicating region that has been filled by a valid     *
+     * level-set function (i.e. the value of the level-set was informed by      *
+     * nearby EB facets)                                                        *
+     *                                                                          *
+     ***************************************************************************/
+
+    std::unique_ptr<iMultiFab> region_valid = std::unique_ptr<iMultiFab>(new iMultiFab);
+    region_valid->define(ls_ba, ls_dm, 1, ls_grid_pad);
+    region_valid->setVal(0);
+
+    RealVect dx(AMREX_D_DECL(geom_ls.CellSize(0),
+                             geom_ls.CellSize(1),
+                             geom_ls.CellSize(2)));
+
+    RealVect dx_eb(AMREX_D_DECL(geom_eb.CellSize(0),
+                                geom_eb.CellSize(1),
+                                geom_eb.CellSize(2)));
+
+
+    /****************************************************************************
+     *                                                                          *
+     * Access EB Cut-Cell data, and compute normals (same as fill_data)         *
+     *                                                                          *
+     ***************************************************************************/
+
+    // With sparse storage, the boundary centroids of a tile are filled in a
+    // temporary (see EBFArrayBoxFactory::bndryCentFab)
+    const auto & flags = eb_factory.getMultiEBCellFlagFab();
+
+    const int eb_pad = flags.nGrow();
+
+    MultiFab normal(eb_factory.boxArray(), ls_dm, 3, eb_pad);
+    amrex::FillEBNormals(normal, eb_factory, geom_eb);
+
+    iMultiFab eb_valid(ls_ba, ls_dm, 1, ls_grid_pad);
+    eb_valid.setVal(0);
+
+    // Same threshold as fill_data => tiles far from any EB facet hold exactly
+    // +/- ls_threshold after a Fill
+    const Real min_dx = LSUtility::min_dx(geom_eb);
+    const Real ls_threshold = min_dx * (eb_pad + 1);
+
+    // Number of level-set nodes spanned by the threshold
+    const int sweep_pad = static_cast<int>(std::ceil(ls_threshold / LSUtility::min_dx(geom_ls)));
+
+    // Tiles that have been filled again, for each local box
+    Vector<Vector<Box>> updated(ls_grid->IndexArray().size());
+
+
+    /****************************************************************************
+     *                                                                          *
+     * Loop over EB tile boxes (ebt), skipping those that are far from both the *
+     * old and the new EB surface                                               *
+     *                                                                          *
+     ***************************************************************************/
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(* ls_grid, ebt_size * std::max(1, ls_grid_ref/eb_grid_ref)); mfi.isValid(); ++mfi)
+    {
+        Box tile_box = mfi.growntilebox();
+
+        const auto & if_tile = mf_impfunc[mfi];
+              auto & v_tile  = eb_valid[mfi];
+              auto & ls_tile = (* ls_grid)[mfi];
+
+        //_______________________________________________________________________
+        // Count EB facets near the tile (new EB surface)
+        Box eb_search = mfi.tilebox();
+        eb_search.coarsen(ls_grid_ref);
+        eb_search.refine(eb_grid_ref);
+        eb_search.enclosedCells();
+        eb_search.grow(eb_pad);
+
+        int n_facets = 0;
+        if (flags[mfi].getType() == FabType::singlevalued) {
+            amrex_eb_count_facets(BL_TO_FORTRAN_BOX(eb_search),
+                                  BL_TO_FORTRAN_3D(flags[mfi]),
+                                  & n_facets);
+        }
+
+
+        if (n_facets > 0) {
+
+            FArrayBox bcent_tmp;
+            const auto & bcent_tile = eb_factory.bndryCentFab(mfi, eb_search, bcent_tmp);
+            std::unique_ptr<Vector<Real>> facets = eb_facets(normal[mfi], bcent_tile,
+                                                             flags[mfi], dx_eb, eb_search);
+            int len_facets = facets->size();
+
+            //___________________________________________________________________
+            // Work on the tile grown by the threshold, so that the distance to
+            // facets outside the tile box can be extended into it
+            Box sweep_box = amrex::grow(tile_box, sweep_pad);
+
+            FArrayBox guess(sweep_box);
+            FArrayBox ls_sweep(sweep_box);
+            IArrayBox v_sweep(sweep_box);
+
+            //___________________________________________________________________
+            // Distance to the EB facets within `band` nodes of the facets,
+            // ls_threshold elsewhere
+            amrex_eb_levelset_band(BL_TO_FORTRAN_BOX(sweep_box), & band, & ls_threshold,
+                                   facets->dataPtr(), & len_facets,
+                                   BL_TO_FORTRAN_3D(guess), dx.dataPtr());
+
+            amrex_eb_fill_levelset_loc(BL_TO_FORTRAN_BOX(sweep_box),
+                                       facets->dataPtr(), & len_facets,
+                                       BL_TO_FORTRAN_3D(v_sweep),
+                                       BL_TO_FORTRAN_3D(ls_sweep),
+                                       BL_TO_FORTRAN_3D(guess), & ls_threshold,
+                                       dx.dataPtr(), dx_eb.dataPtr()              );
+
+            //___________________________________________________________________
+            // Extend the distance outward from the band. NOTE: the sign of the
+            // level-set is set by validating it against the implicit function
+            // on the tile box only
+            amrex_eb_sweep_levelset(BL_TO_FORTRAN_BOX(sweep_box), & ls_threshold,
+                                    BL_TO_FORTRAN_3D(guess),
+                                    BL_TO_FORTRAN_3D(ls_sweep),
+                                    dx.dataPtr()                          );
+
+            ls_tile.copy(ls_sweep, tile_box);
+            v_tile.copy(v_sweep, tile_box);
+
+            amrex_eb_validate_levelset(BL_TO_FORTRAN_BOX(tile_box), & ls_grid_ref,
+                                       BL_TO_FORTRAN_3D(if_tile),
+                                       BL_TO_FORTRAN_3D(v_tile),
+                                       BL_TO_FORTRAN_3D(ls_tile)   );
+
+            amrex_eb_threshold_levelset(BL_TO_FORTRAN_BOX(tile_box), & ls_threshold,
+                                        BL_TO_FORTRAN_3D(ls_tile));
+
+            (* region_valid)[mfi].setVal(1);
+
+        } else {
+
+            //___________________________________________________________________
+            // No EB facets => nothing to do unless the EB surface used to be
+            // near this tile
+            int changed = 0;
+            amrex_eb_check_levelset(BL_TO_FORTRAN_BOX(tile_box), & ls_threshold,
+                                    BL_TO_FORTRAN_3D(if_tile),
+                                    BL_TO_FORTRAN_3D(ls_tile),
+                                    & changed);
+            if (changed == 0) continue;
+
+            ls_tile.setVal(ls_threshold, tile_box);
+            amrex_eb_validate_levelset(BL_TO_FORTRAN_BOX(tile_box), & ls_grid_ref,
+                                       BL_TO_FORTRAN_3D(if_tile),
+                                       BL_TO_FORTRAN_3D(v_tile),
+                                       BL_TO_FORTRAN_3D(ls_tile)   );
+        }
+
+#ifdef _OPENMP
+#pragma omp critical (lsfactory_update)
+#endif
+        updated[mfi.LocalIndex()].push_back(mfi.tilebox());
+    }
+
+    fill_valid(updated);
+
+    return region_valid;
+}
+
+
+
 std::unique_ptr<iMultiFab> LSFactory::Intersect(const EBFArrayBoxFactory & eb_factory,
                                                 const MultiFab & mf_impfunc) {
 
@@ -19,35 +19,43 @@ namespace amrex {
 
         // Dummy array for MFIter
         MultiFab dummy(ba, dm, 1, n_grow, MFInfo(), eb_factory);
-        // Area fraction data
-        std::array<const MultiCutFab*, AMREX_SPACEDIM> areafrac = eb_factory.getAreaFrac();
-
         const auto & flags = eb_factory.getMultiEBCellFlagFab();
 
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
-        for(MFIter mfi(dummy, true); mfi.isValid(); ++mfi) {
-            Box tile_box = mfi.growntilebox();
-            const int * lo = tile_box.loVect();
-            const int * hi = tile_box.hiVect();
-
-            const auto & flag = flags[mfi];
-
-            if (flag.getType(tile_box) == FabType::singlevalued) {
-                // Target for compute_normals(...)
-                auto & norm_tile = normals[mfi];
-                // Area fractions in x, y, and z directions
-                const auto & af_x_tile = (* areafrac[0])[mfi];
-                const auto & af_y_tile = (* areafrac[1])[mfi];
-                const auto & af_z_tile = (* areafrac[2])[mfi];
-
-                amrex_eb_compute_normals(lo, hi,
-                                         BL_TO_FORTRAN_3D(flag),
-                                         BL_TO_FORTRAN_3D(norm_tile),
-                                         BL_TO_FORTRAN_3D(af_x_tile),
-                                         BL_TO_FORTRAN_3D(af_y_tile),
-                                         BL_TO_FORTRAN_3D(af_z_tile)  );
+        {
+            // With sparse storage, the area fractions of a tile are filled here
+            std::array<FArrayBox, AMREX_SPACEDIM> af_tmp;
+
+            for(MFIter mfi(dummy, true); mfi.isValid(); ++mfi) {
+                Box tile_box = mfi.growntilebox();
+                const int * lo = tile_box.loVect();
+                const int * hi = tile_box.hiVect();
+
+                const auto & flag = flags[mfi];
+
+                if (flag.getType(tile_box) == FabType::singlevalued) {
+                    // Target for compute_normals(...)
+                    auto & norm_tile = normals[mfi];
+                    // Area fractions in x, y, and z directions
+                    std::array<const FArrayBox*, AMREX_SPACEDIM> areafrac;
+                    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                        areafrac[idim] = &eb_factory.areaFracFab(mfi, idim,
+                                                                 amrex::surroundingNodes(tile_box, idim),
+                                                                 af_tmp[idim]);
+                    }
+                    const auto & af_x_tile = * areafrac[0];
+                    const auto & af_y_tile = * areafrac[1];
+                    const auto & af_z_tile = * areafrac[2];
+
+                    amrex_eb_compute_normals(lo, hi,
+                                             BL_TO_FORTRAN_3D(flag),
+                                             BL_TO_FORTRAN_3D(norm_tile),
+                                             BL_TO_FORTRAN_3D(af_x_tile),
+                                             BL_TO_FORTRAN_3D(af_y_tile),
+                                             BL_TO_FORTRAN_3D(af_z_tile)  );
+                }
             }
         }
 
@@ -142,7 +142,8 @@ MLALaplacian::prepareForSolve ()
 }
 
 void
-MLALaplacian::Fapply (int amrlev, int mglev, MultiFab& out, const MultiFab& in) const
+MLALaplacian::Fapply (int amrlev, int mglev, MultiFab& out, const MultiFab& in,
+                      FRegion region) const
 {
     BL_PROFILE("MLALaplacian::Fapply()");
 
@@ -154,7 +155,6 @@ MLALaplacian::Fapply (int amrlev, int mglev, MultiFab& out, const MultiFab& in)
 #endif
     for (MFIter mfi(out, true); mfi.isValid(); ++mfi)
     {
-        const Box& bx = mfi.tilebox();
         const FArrayBox& xfab = in[mfi];
         FArrayBox& yfab = out[mfi];
         const FArrayBox& afab = acoef[mfi];
@@ -166,15 +166,17 @@ MLALaplacian::Fapply (int amrlev, int mglev, MultiFab& out, const MultiFab& in)
         const Box& vbx = mfi.validbox();
 #endif
 
-        amrex_mlalap_adotx(BL_TO_FORTRAN_BOX(bx),
-                           BL_TO_FORTRAN_ANYD(yfab),
-                           BL_TO_FORTRAN_ANYD(xfab),
-                           BL_TO_FORTRAN_ANYD(afab),
+        for (const Box& bx : regionBoxes(mfi, region))
+        {
+            amrex_mlalap_adotx(BL_TO_FORTRAN_BOX(bx),
+                               BL_TO_FORTRAN_ANYD(yfab),
+                               BL_TO_FORTRAN_ANYD(xfab),
+                               BL_TO_FORTRAN_ANYD(afab),
 #if (AMREX_SPACEDIM != 3)
-                           rc.data(), re.data(), vbx.loVect(), vbx.hiVect(),
+                               rc.data(), re.data(), vbx.loVect(), vbx.hiVect(),
 #endif
-                           dxinv, m_a_scalar, m_b_scalar);
-
+                               dxinv, m_a_scalar, m_b_scalar);
+        }
     }
 }
 
@@ -214,7 +216,8 @@ MLALaplacian::normalize (int amrlev, int mglev, MultiFab& mf) const
 }
 
 void
-MLALaplacian::Fsmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs, int redblack) const
+MLALaplacian::Fsmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs, int redblack,
+                       FRegion region) const
 {
     BL_PROFILE("MLALaplacian::Fsmooth()");
 
@@ -265,7 +268,6 @@ MLALaplacian::Fsmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs
 #endif
 #endif
 
-        const Box&       tbx     = mfi.tilebox();
         const Box&       vbx     = mfi.validbox();
         FArrayBox&       solnfab = sol[mfi];
         const FArrayBox& rhsfab  = rhs[mfi];
@@ -282,6 +284,8 @@ MLALaplacian::Fsmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs
 #endif
 #endif
 
+        for (const Box& tbx : regionBoxes(mfi, region))
+        {
 #if (AMREX_SPACEDIM == 1)
 #endif
 
@@ -289,26 +293,27 @@ MLALaplacian::Fsmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs
 #endif
 
 #if (AMREX_SPACEDIM == 3)
-        amrex_mlalap_gsrb(BL_TO_FORTRAN_BOX(tbx),
-                          BL_TO_FORTRAN_ANYD(solnfab),
-                          BL_TO_FORTRAN_ANYD(rhsfab),
-                          BL_TO_FORTRAN_ANYD(f0fab),
-                          BL_TO_FORTRAN_ANYD(f1fab),
-                          BL_TO_FORTRAN_ANYD(f2fab),
-                          BL_TO_FORTRAN_ANYD(f3fab),
-                          BL_TO_FORTRAN_ANYD(f4fab),
-                          BL_TO_FORTRAN_ANYD(f5fab),
-                          BL_TO_FORTRAN_ANYD(m0),
-                          BL_TO_FORTRAN_ANYD(m1),
-                          BL_TO_FORTRAN_ANYD(m2),
-                          BL_TO_FORTRAN_ANYD(m3),
-                          BL_TO_FORTRAN_ANYD(m4),
-                          BL_TO_FORTRAN_ANYD(m5),
-                          BL_TO_FORTRAN_ANYD(afab),
-                          BL_TO_FORTRAN_BOX(vbx), dxinv,
-                          &m_a_scalar, &m_b_scalar,
-                          redblack);
+            amrex_mlalap_gsrb(BL_TO_FORTRAN_BOX(tbx),
+                              BL_TO_FORTRAN_ANYD(solnfab),
+                              BL_TO_FORTRAN_ANYD(rhsfab),
+                              BL_TO_FORTRAN_ANYD(f0fab),
+                              BL_TO_FORTRAN_ANYD(f1fab),
+                              BL_TO_FORTRAN_ANYD(f2fab),
+                              BL_TO_FORTRAN_ANYD(f3fab),
+                              BL_TO_FORTRAN_ANYD(f4fab),
+                              BL_TO_FORTRAN_ANYD(f5fab),
+                              BL_TO_FORTRAN_ANYD(m0),
+                              BL_TO_FORTRAN_ANYD(m1),
+                              BL_TO_FORTRAN_ANYD(m2),
+                              BL_TO_FORTRAN_ANYD(m3),
+                              BL_TO_FORTRAN_ANYD(m4),
+                              BL_TO_FORTRAN_ANYD(m5),
+                              BL_TO_FORTRAN_ANYD(afab),
+                              BL_TO_FORTRAN_BOX(vbx), dxinv,
+                              &m_a_scalar, &m_b_scalar,
+                              redblack);
 #endif
+        }
     }
 }
 
@@ -124,6 +124,8 @@ MLCGSolver::solve_bicgstab (MultiFab&       sol,
     int ret = 0, nit = 1;
     Real rho_1 = 0, alpha = 0, omega = 0;
 
+    iter = 0;
+
     if ( rnorm0 == 0 || rnorm0 < eps_abs )
     {
         if ( verbose > 0 )
@@ -228,6 +230,8 @@ MLCGSolver::solve_bicgstab (MultiFab&       sol,
         rho_1 = rho;
     }
 
+    iter = std::min(nit, maxiter);
+
     if ( verbose > 0 )
     {
         amrex::Print() << "MLCGSolver_BiCGStab: Final: Iteration "
@@ -296,6 +300,8 @@ MLCGSolver::solve_cg (MultiFab&       sol,
     int  ret           = 0;
     int  nit           = 1;
 
+    iter = 0;
+
     if ( rnorm0 == 0 || rnorm0 < eps_abs )
     {
         if ( verbose > 0 ) {
@@ -360,6 +366,8 @@ MLCGSolver::solve_cg (MultiFab&       sol,
 
         rho_1 = rho;
     }
+
+    iter = std::min(nit, maxiter);
     
     if ( verbose > 0 )
     {
@@ -341,11 +341,29 @@ MLCellLinOp::apply (int amrlev, int mglev, MultiFab& out, MultiFab& in, BCMode b
                     StateMode s_mode, const MLMGBndry* bndry) const
 {
     BL_PROFILE("MLCellLinOp::apply()");
-    applyBC(amrlev, mglev, in, bc_mode, s_mode, bndry);
 #ifdef AMREX_SOFT_PERF_COUNTERS
     perf_counters.apply(out);
 #endif
-    Fapply(amrlev, mglev, out, in);
+    if (overlapComm())
+    {
+        {
+            CommStatsScope css(*this, amrlev, mglev);
+            in.FillBoundary_nowait(0, getNComp(), m_geom[amrlev][mglev].periodicity(),
+                                   isCrossStencil());
+        }
+        Fapply(amrlev, mglev, out, in, FRegion::interior);
+        {
+            CommStatsScope css(*this, amrlev, mglev);
+            in.FillBoundary_finish();
+        }
+        applyBC(amrlev, mglev, in, bc_mode, s_mode, bndry, true);
+        Fapply(amrlev, mglev, out, in, FRegion::boundary);
+    }
+    else
+    {
+        applyBC(amrlev, mglev, in, bc_mode, s_mode, bndry);
+        Fapply(amrlev, mglev, out, in, FRegion::all);
+    }
 }
 
 void
@@ -353,18 +371,56 @@ MLCellLinOp::smooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs,
                      bool skip_fillboundary) const
 {
     BL_PROFILE("MLCellLinOp::smooth()");
-    for (int redblack = 0; redblack < 2; ++redblack)
+    const bool overlap = overlapComm();
+    const int npasses = numSmoothPasses(amrlev, mglev);
+    for (int redblack = 0; redblack < npasses; ++redblack)
     {
-        applyBC(amrlev, mglev, sol, BCMode::Homogeneous, StateMode::Solution,
-                nullptr, skip_fillboundary);
 #ifdef AMREX_SOFT_PERF_COUNTERS
         perf_counters.smooth(sol);
 #endif
-        Fsmooth(amrlev, mglev, sol, rhs, redblack);
+        if (overlap && !skip_fillboundary)
+        {
+            {
+                CommStatsScope css(*this, amrlev, mglev);
+                sol.FillBoundary_nowait(0, getNComp(), m_geom[amrlev][mglev].periodicity(),
+                                        isCrossStencil());
+            }
+            Fsmooth(amrlev, mglev, sol, rhs, redblack, FRegion::interior);
+            {
+                CommStatsScope css(*this, amrlev, mglev);
+                sol.FillBoundary_finish();
+            }
+            applyBC(amrlev, mglev, sol, BCMode::Homogeneous, StateMode::Solution,
+                    nullptr, true);
+            Fsmooth(amrlev, mglev, sol, rhs, redblack, FRegion::boundary);
+        }
+        else
+        {
+            applyBC(amrlev, mglev, sol, BCMode::Homogeneous, StateMode::Solution,
+                    nullptr, skip_fillboundary);
+            Fsmooth(amrlev, mglev, sol, rhs, redblack, FRegion::all);
+        }
         skip_fillboundary = false;
     }
 }
 
+BoxList
+MLCellLinOp::regionBoxes (const MFIter& mfi, FRegion region)
+{
+    const Box& tbx = mfi.tilebox();
+    if (region == FRegion::all) {
+        return BoxList(tbx);
+    }
+
+    // The stencils are one cell wide.
+    const Box& ibx = amrex::grow(mfi.validbox(), -1) & tbx;
+    if (region == FRegion::interior) {
+        return ibx.ok() ? BoxList(ibx) : BoxList(tbx.ixType());
+    } else {
+        return ibx.ok() ? amrex::boxDiff(tbx, ibx) : BoxList(tbx);
+    }
+}
+
 void
 MLCellLinOp::updateSolBC (int amrlev, const MultiFab& crse_bcdata) const
 {
@@ -453,6 +509,7 @@ MLCellLinOp::applyBC (int amrlev, int mglev, MultiFab& in, BCMode bc_mode, State
     const int ncomp = getNComp();
     const int cross = isCrossStencil();
     if (!skip_fillboundary) {
+        CommStatsScope css(*this, amrlev, mglev);
         in.FillBoundary(0, ncomp, m_geom[amrlev][mglev].periodicity(),cross); 
     }
 
@@ -583,9 +640,9 @@ MLCellLinOp::compFlux (int amrlev, const Array<MultiFab*,AMREX_SPACEDIM>& fluxes
         for (MFIter mfi(sol, MFItInfo().EnableTiling().SetDynamic(true));  mfi.isValid(); ++mfi)
         {
             const Box& tbx = mfi.tilebox();
-            AMREX_D_TERM(flux[0].resize(amrex::surroundingNodes(tbx,0));,
-                         flux[1].resize(amrex::surroundingNodes(tbx,1));,
-                         flux[2].resize(amrex::surroundingNodes(tbx,2)););
+            AMREX_D_TERM(flux[0].resize(amrex::surroundingNodes(tbx,0),ncomp);,
+                         flux[1].resize(amrex::surroundingNodes(tbx,1),ncomp);,
+                         flux[2].resize(amrex::surroundingNodes(tbx,2),ncomp););
             FFlux(amrlev, mfi, pflux, sol[mfi], loc);
             for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
                 const Box& nbx = mfi.nodaltilebox(idim);
@@ -22,6 +22,49 @@
 
 namespace amrex {
 
+namespace {
+
+// The EB data of the tile at mfi on the cells of bx and one ghost cell.
+// With sparse storage they are filled in the temporaries here, and the
+// dense MultiCutFabs of the factory are not rebuilt.
+class EBTileData
+{
+public:
+    enum { area_frac = 1, face_cent = 2, bndry = 4, all = 7 };
+
+    EBTileData (const EBFArrayBoxFactory& factory, const MFIter& mfi, const Box& bx, int which)
+    {
+        const Box& gbx = amrex::grow(bx,1);
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            const Box& fbx = amrex::surroundingNodes(gbx,idim);
+            if (which & area_frac) {
+                area[idim] = &factory.areaFracFab(mfi, idim, fbx, areatmp[idim]);
+            }
+            if (which & face_cent) {
+                fcent[idim] = &factory.faceCentFab(mfi, idim, fbx, fcenttmp[idim]);
+            }
+        }
+        if (which & bndry) {
+            barea = &factory.bndryAreaFab(mfi, gbx, bareatmp);
+            bcent = &factory.bndryCentFab(mfi, gbx, bcenttmp);
+        }
+    }
+
+    EBTileData (const EBTileData&) = delete;
+    EBTileData& operator= (const EBTileData&) = delete;
+
+    Array<const FArrayBox*,AMREX_SPACEDIM> area {{AMREX_D_DECL(nullptr,nullptr,nullptr)}};
+    Array<const FArrayBox*,AMREX_SPACEDIM> fcent {{AMREX_D_DECL(nullptr,nullptr,nullptr)}};
+    const FArrayBox* barea = nullptr;
+    const FArrayBox* bcent = nullptr;
+
+private:
+    Array<FArrayBox,AMREX_SPACEDIM> areatmp, fcenttmp;
+    FArrayBox bareatmp, bcenttmp;
+};
+
+}
+
 MLEBABecLap::MLEBABecLap (const Vector<Geometry>& a_geom,
                           const Vector<BoxArray>& a_grids,
                           const Vector<DistributionMapping>& a_dmap,
@@ -170,6 +213,7 @@ MLEBABecLap::setEBDirichlet (int amrlev, const MultiFab& phi, const MultiFab& be
 
     auto factory = dynamic_cast<EBFArrayBoxFactory const*>(m_factory[amrlev][0].get());
     const FabArray<EBCellFlagFab>* flags = (factory) ? &(factory->getMultiEBCellFlagFab()) : nullptr;
+    const Vector<FabType>* tiletypes = (factory) ? &(factory->getTileTypes(FabArrayBase::mfiter_tile_size)) : nullptr;
 
 #ifdef _OPENMP
 #pragma omp parallel
@@ -179,7 +223,7 @@ MLEBABecLap::setEBDirichlet (int amrlev, const MultiFab& phi, const MultiFab& be
         const Box& bx = mfi.tilebox();
         FArrayBox& phifab = (*m_eb_phi[amrlev])[mfi];
         FArrayBox& betafab = (*m_eb_b_coeffs[amrlev][0])[mfi];
-        FabType t = (flags) ? (*flags)[mfi].getType(bx) : FabType::regular;
+        FabType t = (tiletypes) ? (*tiletypes)[mfi.tileIndex()] : FabType::regular;
         if (FabType::regular == t or FabType::covered == t) {
             phifab.setVal(0.0, bx, 0, 1);
             betafab.setVal(0.0, bx, 0, 1);
@@ -315,9 +359,12 @@ MLEBABecLap::prepareForSolve ()
 }
 
 void
-MLEBABecLap::Fapply (int amrlev, int mglev, MultiFab& out, const MultiFab& in) const
+MLEBABecLap::Fapply (int amrlev, int mglev, MultiFab& out, const MultiFab& in,
+                     FRegion region) const
 {
     BL_PROFILE("MLEBABecLap::Fapply()");
+    AMREX_ASSERT(region == FRegion::all);
+    amrex::ignore_unused(region);
 
     const MultiFab& acoef = m_a_coeffs[amrlev][mglev];
     AMREX_D_TERM(const MultiFab& bxcoef = m_b_coeffs[amrlev][mglev][0];,
@@ -329,13 +376,8 @@ MLEBABecLap::Fapply (int amrlev, int mglev, MultiFab& out, const MultiFab& in) c
 
     auto factory = dynamic_cast<EBFArrayBoxFactory const*>(m_factory[amrlev][mglev].get());
     const FabArray<EBCellFlagFab>* flags = (factory) ? &(factory->getMultiEBCellFlagFab()) : nullptr;
+    const Vector<FabType>* tiletypes = (factory) ? &(factory->getTileTypes(FabArrayBase::mfiter_tile_size)) : nullptr;
     const MultiFab* vfrac = (factory) ? &(factory->getVolFrac()) : nullptr;
-    auto area = (factory) ? factory->getAreaFrac()
-        : Array<const MultiCutFab*,AMREX_SPACEDIM>{AMREX_D_DECL(nullptr,nullptr,nullptr)};
-    auto fcent = (factory) ? factory->getFaceCent()
-        : Array<const MultiCutFab*,AMREX_SPACEDIM>{AMREX_D_DECL(nullptr,nullptr,nullptr)};
-    const MultiCutFab* barea = (factory) ? &(factory->getBndryArea()) : nullptr;
-    const MultiCutFab* bcent = (factory) ? &(factory->getBndryCent()) : nullptr;
 
     const int is_eb_dirichlet = isEBDirichlet();
     FArrayBox foo(Box::TheUnitBox());
@@ -353,7 +395,7 @@ MLEBABecLap::Fapply (int amrlev, int mglev, MultiFab& out, const MultiFab& in) c
                      const FArrayBox& byfab = bycoef[mfi];,
                      const FArrayBox& bzfab = bzcoef[mfi];);
 
-        auto fabtyp = (flags) ? (*flags)[mfi].getType(bx) : FabType::regular;
+        auto fabtyp = (tiletypes) ? (*tiletypes)[mfi.tileIndex()] : FabType::regular;
 
         if (fabtyp == FabType::covered) {
             yfab.setVal(0.0, bx, 0, 1);
@@ -370,6 +412,7 @@ MLEBABecLap::Fapply (int amrlev, int mglev, MultiFab& out, const MultiFab& in) c
 
             FArrayBox const& bebfab = (is_eb_dirichlet) ? (*m_eb_b_coeffs[amrlev][mglev])[mfi] : foo;
             FArrayBox const& phiebfab = (is_eb_dirichlet && m_is_eb_inhomog) ? (*m_eb_phi[amrlev])[mfi] : foo;
+            const EBTileData eb(*factory, mfi, bx, EBTileData::all);
 
             amrex_mlebabeclap_adotx(BL_TO_FORTRAN_BOX(bx),
                                     BL_TO_FORTRAN_ANYD(yfab),
@@ -381,14 +424,14 @@ MLEBABecLap::Fapply (int amrlev, int mglev, MultiFab& out, const MultiFab& in) c
                                     BL_TO_FORTRAN_ANYD(ccmask[mfi]),
                                     BL_TO_FORTRAN_ANYD((*flags)[mfi]),
                                     BL_TO_FORTRAN_ANYD((*vfrac)[mfi]),
-                                    AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*area[0])[mfi]),
-                                                 BL_TO_FORTRAN_ANYD((*area[1])[mfi]),
-                                                 BL_TO_FORTRAN_ANYD((*area[2])[mfi])),
-                                    AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*fcent[0])[mfi]),
-                                                 BL_TO_FORTRAN_ANYD((*fcent[1])[mfi]),
-                                                 BL_TO_FORTRAN_ANYD((*fcent[2])[mfi])),
-                                    BL_TO_FORTRAN_ANYD((*barea)[mfi]),
-                                    BL_TO_FORTRAN_ANYD((*bcent)[mfi]),
+                                    AMREX_D_DECL(BL_TO_FORTRAN_ANYD(*eb.area[0]),
+                                                 BL_TO_FORTRAN_ANYD(*eb.area[1]),
+                                                 BL_TO_FORTRAN_ANYD(*eb.area[2])),
+                                    AMREX_D_DECL(BL_TO_FORTRAN_ANYD(*eb.fcent[0]),
+                                                 BL_TO_FORTRAN_ANYD(*eb.fcent[1]),
+                                                 BL_TO_FORTRAN_ANYD(*eb.fcent[2])),
+                                    BL_TO_FORTRAN_ANYD(*eb.barea),
+                                    BL_TO_FORTRAN_ANYD(*eb.bcent),
                                     BL_TO_FORTRAN_ANYD(bebfab), is_eb_dirichlet,
                                     BL_TO_FORTRAN_ANYD(phiebfab), m_is_eb_inhomog,
                                     dxinv, m_a_scalar, m_b_scalar);
@@ -397,9 +440,12 @@ MLEBABecLap::Fapply (int amrlev, int mglev, MultiFab& out, const MultiFab& in) c
 }
 
 void
-MLEBABecLap::Fsmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs, int redblack) const
+MLEBABecLap::Fsmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs, int redblack,
+                      FRegion region) const
 {
     BL_PROFILE("MLEBABecLap::Fsmooth()");
+    AMREX_ASSERT(region == FRegion::all);
+    amrex::ignore_unused(region);
 
     const MultiFab& acoef = m_a_coeffs[amrlev][mglev];
     AMREX_D_TERM(const MultiFab& bxcoef = m_b_coeffs[amrlev][mglev][0];,
@@ -439,13 +485,8 @@ MLEBABecLap::Fsmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs,
 
     auto factory = dynamic_cast<EBFArrayBoxFactory const*>(m_factory[amrlev][mglev].get());
     const FabArray<EBCellFlagFab>* flags = (factory) ? &(factory->getMultiEBCellFlagFab()) : nullptr;
+    const Vector<FabType>* tiletypes = (factory) ? &(factory->getTileTypes(IntVect::TheZeroVector())) : nullptr;
     const MultiFab* vfrac = (factory) ? &(factory->getVolFrac()) : nullptr;
-    auto area = (factory) ? factory->getAreaFrac()
-        : Array<const MultiCutFab*,AMREX_SPACEDIM>{AMREX_D_DECL(nullptr,nullptr,nullptr)};
-    auto fcent = (factory) ? factory->getFaceCent()
-        : Array<const MultiCutFab*,AMREX_SPACEDIM>{AMREX_D_DECL(nullptr,nullptr,nullptr)};
-    const MultiCutFab* barea = (factory) ? &(factory->getBndryArea()) : nullptr;
-    const MultiCutFab* bcent = (factory) ? &(factory->getBndryCent()) : nullptr;
 
     const int is_eb_dirichlet = isEBDirichlet();
     FArrayBox foo(Box::TheUnitBox());
@@ -488,7 +529,7 @@ MLEBABecLap::Fsmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs,
 #endif
 #endif
 
-        auto fabtyp = (flags) ? (*flags)[mfi].getType(tbx) : FabType::regular;
+        auto fabtyp = (tiletypes) ? (*tiletypes)[mfi.tileIndex()] : FabType::regular;
 
         if (fabtyp == FabType::covered)
         {
@@ -555,6 +596,7 @@ MLEBABecLap::Fsmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs,
         else
         {
             FArrayBox const& bebfab = (is_eb_dirichlet) ? (*m_eb_b_coeffs[amrlev][mglev])[mfi] : foo;
+            const EBTileData eb(*factory, mfi, tbx, EBTileData::all);
 
             amrex_mlebabeclap_gsrb(BL_TO_FORTRAN_BOX(tbx),
                                    BL_TO_FORTRAN_ANYD(solnfab),
@@ -578,14 +620,14 @@ MLEBABecLap::Fsmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs,
                                                 BL_TO_FORTRAN_ANYD(f5fab)),
                                    BL_TO_FORTRAN_ANYD((*flags)[mfi]),
                                    BL_TO_FORTRAN_ANYD((*vfrac)[mfi]),
-                                   AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*area[0])[mfi]),
-                                                BL_TO_FORTRAN_ANYD((*area[1])[mfi]),
-                                                BL_TO_FORTRAN_ANYD((*area[2])[mfi])),
-                                   AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*fcent[0])[mfi]),
-                                                BL_TO_FORTRAN_ANYD((*fcent[1])[mfi]),
-                                                BL_TO_FORTRAN_ANYD((*fcent[2])[mfi])),
-                                   BL_TO_FORTRAN_ANYD((*barea)[mfi]),
-                                   BL_TO_FORTRAN_ANYD((*bcent)[mfi]),
+                                   AMREX_D_DECL(BL_TO_FORTRAN_ANYD(*eb.area[0]),
+                                                BL_TO_FORTRAN_ANYD(*eb.area[1]),
+                                                BL_TO_FORTRAN_ANYD(*eb.area[2])),
+                                   AMREX_D_DECL(BL_TO_FORTRAN_ANYD(*eb.fcent[0]),
+                                                BL_TO_FORTRAN_ANYD(*eb.fcent[1]),
+                                                BL_TO_FORTRAN_ANYD(*eb.fcent[2])),
+                                   BL_TO_FORTRAN_ANYD(*eb.barea),
+                                   BL_TO_FORTRAN_ANYD(*eb.bcent),
                                    BL_TO_FORTRAN_ANYD(bebfab), is_eb_dirichlet,
                                    dxinv, m_a_scalar, m_b_scalar, redblack);
         }
@@ -626,28 +668,27 @@ MLEBABecLap::FFlux (int amrlev, const MFIter& mfi, const Array<FArrayBox*,AMREX_
                                           BL_TO_FORTRAN_ANYD(bz)),
                              dxinv, m_b_scalar, face_only);
         if (fabtyp != FabType::regular && !face_only) {
-            const auto& area = factory->getAreaFrac();
+            const EBTileData eb(*factory, mfi, box, EBTileData::area_frac);
             for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
                 const Box& fbx = amrex::surroundingNodes(box,idim);
                 amrex_eb_set_covered_faces(BL_TO_FORTRAN_BOX(fbx),
                                            BL_TO_FORTRAN_ANYD(*flux[idim]),
-                                           BL_TO_FORTRAN_ANYD((*area[idim])[mfi]));
+                                           BL_TO_FORTRAN_ANYD(*eb.area[idim]));
             }
         }
     } else {               
-        const auto& area = factory->getAreaFrac();
-        const auto& fcent = factory->getFaceCent();
+        const EBTileData eb(*factory, mfi, box, EBTileData::area_frac | EBTileData::face_cent);
 
         amrex_mlebabeclap_flux(BL_TO_FORTRAN_BOX(box), 
                                AMREX_D_DECL(BL_TO_FORTRAN_ANYD(*flux[0]),
                                             BL_TO_FORTRAN_ANYD(*flux[1]), 
                                             BL_TO_FORTRAN_ANYD(*flux[2])),
-                               AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*area[0])[mfi]), 
-                                            BL_TO_FORTRAN_ANYD((*area[1])[mfi]),
-                                            BL_TO_FORTRAN_ANYD((*area[2])[mfi])),
-                               AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*fcent[0])[mfi]),
-                                            BL_TO_FORTRAN_ANYD((*fcent[1])[mfi]),
-                                            BL_TO_FORTRAN_ANYD((*fcent[2])[mfi])),
+                               AMREX_D_DECL(BL_TO_FORTRAN_ANYD(*eb.area[0]), 
+                                            BL_TO_FORTRAN_ANYD(*eb.area[1]),
+                                            BL_TO_FORTRAN_ANYD(*eb.area[2])),
+                               AMREX_D_DECL(BL_TO_FORTRAN_ANYD(*eb.fcent[0]),
+                                            BL_TO_FORTRAN_ANYD(*eb.fcent[1]),
+                                            BL_TO_FORTRAN_ANYD(*eb.fcent[2])),
                                BL_TO_FORTRAN_ANYD(sol),
                                AMREX_D_DECL(BL_TO_FORTRAN_ANYD(bx),
                                             BL_TO_FORTRAN_ANYD(by),
@@ -674,10 +715,7 @@ MLEBABecLap::compGrad (int amrlev, const Array<MultiFab*,AMREX_SPACEDIM>& grad,
 
     auto factory = dynamic_cast<EBFArrayBoxFactory const*>(m_factory[amrlev][mglev].get()); 
     const FabArray<EBCellFlagFab>* flags = (factory) ? &(factory->getMultiEBCellFlagFab()) : nullptr; 
-    auto area = (factory) ? factory->getAreaFrac() : 
-        Array<const MultiCutFab*, AMREX_SPACEDIM>{AMREX_D_DECL(nullptr, nullptr, nullptr)}; 
-    auto fcent = (factory) ? factory->getFaceCent():
-        Array<const MultiCutFab*, AMREX_SPACEDIM>{AMREX_D_DECL(nullptr, nullptr, nullptr)}; 
+    const Vector<FabType>* tiletypes = (factory) ? &(factory->getTileTypes(FabArrayBase::mfiter_tile_size)) : nullptr;
 
 #ifdef _OPENMP
 #pragma omp parallel
@@ -685,7 +723,7 @@ MLEBABecLap::compGrad (int amrlev, const Array<MultiFab*,AMREX_SPACEDIM>& grad,
     for (MFIter mfi(sol, MFItInfo().EnableTiling().SetDynamic(true)); mfi.isValid(); ++mfi)
     {
         const Box& box = mfi.tilebox(); 
-        auto fabtyp = (flags) ? (*flags)[mfi].getType(box) :FabType::regular;
+        auto fabtyp = (tiletypes) ? (*tiletypes)[mfi.tileIndex()] :FabType::regular;
         Array<Box,AMREX_SPACEDIM> fbx{AMREX_D_DECL(mfi.nodaltilebox(0),
                                                    mfi.nodaltilebox(1),
                                                    mfi.nodaltilebox(2))};
@@ -703,13 +741,15 @@ MLEBABecLap::compGrad (int amrlev, const Array<MultiFab*,AMREX_SPACEDIM>& grad,
                                             BL_TO_FORTRAN_ANYD((*grad[2])[mfi])),
                                dxinv);
             if (fabtyp != FabType::regular) {
+                const EBTileData eb(*factory, mfi, box, EBTileData::area_frac);
                 for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
                     amrex_eb_set_covered_faces(BL_TO_FORTRAN_BOX(fbx[idim]),
                                                BL_TO_FORTRAN_ANYD((*grad[idim])[mfi]),
-                                               BL_TO_FORTRAN_ANYD((*area[idim])[mfi]));
+                                               BL_TO_FORTRAN_ANYD(*eb.area[idim]));
                 }
             }
         } else {
+           const EBTileData eb(*factory, mfi, box, EBTileData::area_frac | EBTileData::face_cent);
            amrex_mlebabeclap_grad(AMREX_D_DECL(BL_TO_FORTRAN_BOX(fbx[0]),
                                                BL_TO_FORTRAN_BOX(fbx[1]),
                                                BL_TO_FORTRAN_BOX(fbx[2])),
@@ -717,12 +757,12 @@ MLEBABecLap::compGrad (int amrlev, const Array<MultiFab*,AMREX_SPACEDIM>& grad,
                                   AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*grad[0])[mfi]),
                                                BL_TO_FORTRAN_ANYD((*grad[1])[mfi]),
                                                BL_TO_FORTRAN_ANYD((*grad[2])[mfi])),
-                                  AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*area[0])[mfi]),
-                                               BL_TO_FORTRAN_ANYD((*area[1])[mfi]),
-                                               BL_TO_FORTRAN_ANYD((*area[2])[mfi])),
-                                  AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*fcent[0])[mfi]),
-                                               BL_TO_FORTRAN_ANYD((*fcent[1])[mfi]),
-                                               BL_TO_FORTRAN_ANYD((*fcent[2])[mfi])),
+                                  AMREX_D_DECL(BL_TO_FORTRAN_ANYD(*eb.area[0]),
+                                               BL_TO_FORTRAN_ANYD(*eb.area[1]),
+                                               BL_TO_FORTRAN_ANYD(*eb.area[2])),
+                                  AMREX_D_DECL(BL_TO_FORTRAN_ANYD(*eb.fcent[0]),
+                                               BL_TO_FORTRAN_ANYD(*eb.fcent[1]),
+                                               BL_TO_FORTRAN_ANYD(*eb.fcent[2])),
                                   BL_TO_FORTRAN_ANYD(ccmask[mfi]),
                                   BL_TO_FORTRAN_ANYD((*flags)[mfi]), dxinv);
 
@@ -743,13 +783,8 @@ MLEBABecLap::normalize (int amrlev, int mglev, MultiFab& mf) const
 
     auto factory = dynamic_cast<EBFArrayBoxFactory const*>(m_factory[amrlev][mglev].get());
     const FabArray<EBCellFlagFab>* flags = (factory) ? &(factory->getMultiEBCellFlagFab()) : nullptr;
+    const Vector<FabType>* tiletypes = (factory) ? &(factory->getTileTypes(FabArrayBase::mfiter_tile_size)) : nullptr;
     const MultiFab* vfrac = (factory) ? &(factory->getVolFrac()) : nullptr;
-    auto area = (factory) ? factory->getAreaFrac()
-        : Array<const MultiCutFab*,AMREX_SPACEDIM>{AMREX_D_DECL(nullptr,nullptr,nullptr)};
-    auto fcent = (factory) ? factory->getFaceCent()
-        : Array<const MultiCutFab*,AMREX_SPACEDIM>{AMREX_D_DECL(nullptr,nullptr,nullptr)};
-    const MultiCutFab* barea = (factory) ? &(factory->getBndryArea()) : nullptr;
-    const MultiCutFab* bcent = (factory) ? &(factory->getBndryCent()) : nullptr;
 
     const int is_eb_dirichlet = isEBDirichlet();
     FArrayBox foo(Box::TheUnitBox());
@@ -766,7 +801,7 @@ MLEBABecLap::normalize (int amrlev, int mglev, MultiFab& mf) const
                      const FArrayBox& byfab = bycoef[mfi];,
                      const FArrayBox& bzfab = bzcoef[mfi];);
 
-        auto fabtyp = (flags) ? (*flags)[mfi].getType(bx) : FabType::regular;
+        auto fabtyp = (tiletypes) ? (*tiletypes)[mfi.tileIndex()] : FabType::regular;
 
         if (fabtyp == FabType::regular)
         {
@@ -781,6 +816,7 @@ MLEBABecLap::normalize (int amrlev, int mglev, MultiFab& mf) const
         else if (fabtyp == FabType::singlevalued)
         {
             FArrayBox const& bebfab = (is_eb_dirichlet) ? (*m_eb_b_coeffs[amrlev][mglev])[mfi] : foo;
+            const EBTileData eb(*factory, mfi, bx, EBTileData::all);
 
             amrex_mlebabeclap_normalize(BL_TO_FORTRAN_BOX(bx),
                                         BL_TO_FORTRAN_ANYD(fab),
@@ -791,14 +827,14 @@ MLEBABecLap::normalize (int amrlev, int mglev, MultiFab& mf) const
                                         BL_TO_FORTRAN_ANYD(ccmask[mfi]),
                                         BL_TO_FORTRAN_ANYD((*flags)[mfi]),
                                         BL_TO_FORTRAN_ANYD((*vfrac)[mfi]),
-                                        AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*area[0])[mfi]),
-                                                     BL_TO_FORTRAN_ANYD((*area[1])[mfi]),
-                                                     BL_TO_FORTRAN_ANYD((*area[2])[mfi])),
-                                        AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*fcent[0])[mfi]),
-                                                     BL_TO_FORTRAN_ANYD((*fcent[1])[mfi]),
-                                                     BL_TO_FORTRAN_ANYD((*fcent[2])[mfi])),
-                                        BL_TO_FORTRAN_ANYD((*barea)[mfi]),
-                                        BL_TO_FORTRAN_ANYD((*bcent)[mfi]),
+                                        AMREX_D_DECL(BL_TO_FORTRAN_ANYD(*eb.area[0]),
+                                                     BL_TO_FORTRAN_ANYD(*eb.area[1]),
+                                                     BL_TO_FORTRAN_ANYD(*eb.area[2])),
+                                        AMREX_D_DECL(BL_TO_FORTRAN_ANYD(*eb.fcent[0]),
+                                                     BL_TO_FORTRAN_ANYD(*eb.fcent[1]),
+                                                     BL_TO_FORTRAN_ANYD(*eb.fcent[2])),
+                                        BL_TO_FORTRAN_ANYD(*eb.barea),
+                                        BL_TO_FORTRAN_ANYD(*eb.bcent),
                                         BL_TO_FORTRAN_ANYD(bebfab),
                                         is_eb_dirichlet,
                                         dxinv, m_a_scalar, m_b_scalar);
@@ -872,6 +908,7 @@ MLEBABecLap::applyBC (int amrlev, int mglev, MultiFab& in, BCMode bc_mode, State
 
     const int ncomp = getNComp();
     if (!skip_fillboundary) {
+        CommStatsScope css(*this, amrlev, mglev);
         const int cross = false;
         in.FillBoundary(0, ncomp, m_geom[amrlev][mglev].periodicity(),cross);
     }
@@ -888,8 +925,7 @@ MLEBABecLap::applyBC (int amrlev, int mglev, MultiFab& in, BCMode bc_mode, State
     
     auto factory = dynamic_cast<EBFArrayBoxFactory const*>(m_factory[amrlev][mglev].get());
     const FabArray<EBCellFlagFab>* flags = (factory) ? &(factory->getMultiEBCellFlagFab()) : nullptr;
-    auto area = (factory) ? factory->getAreaFrac()
-        : Array<const MultiCutFab*,AMREX_SPACEDIM>{AMREX_D_DECL(nullptr,nullptr,nullptr)};
+    const Vector<FabType>* tiletypes = (factory) ? &(factory->getTileTypes(IntVect::TheZeroVector())) : nullptr;
     
     FArrayBox foo(Box::TheUnitBox(),ncomp);
     foo.setVal(10.0);
@@ -902,11 +938,16 @@ MLEBABecLap::applyBC (int amrlev, int mglev, MultiFab& in, BCMode bc_mode, State
         const Box& vbx   = mfi.validbox();
         FArrayBox& iofab = in[mfi];
 
-        auto fabtyp = (flags) ? (*flags)[mfi].getType(vbx) : FabType::regular;
+        auto fabtyp = (tiletypes) ? (*tiletypes)[mfi.tileIndex()] : FabType::regular;
         if (fabtyp != FabType::covered)
         {
             const RealTuple & bdl = bcondloc.bndryLocs(mfi);
             const BCTuple   & bdc = bcondloc.bndryConds(mfi);
+
+            std::unique_ptr<EBTileData> eb;
+            if (fabtyp != FabType::regular) {
+                eb.reset(new EBTileData(*factory, mfi, vbx, EBTileData::area_frac));
+            }
             
             for (OrientationIter oitr; oitr; ++oitr)
             {
@@ -934,9 +975,9 @@ MLEBABecLap::applyBC (int amrlev, int mglev, MultiFab& in, BCMode bc_mode, State
                     amrex_mlebabeclap_apply_bc(BL_TO_FORTRAN_BOX(vbx),
                                                BL_TO_FORTRAN_ANYD(iofab),
                                                BL_TO_FORTRAN_ANYD((*flags)[mfi]),
-                                               AMREX_D_DECL(BL_TO_FORTRAN_ANYD((*area[0])[mfi]),
-                                                            BL_TO_FORTRAN_ANYD((*area[1])[mfi]),
-                                                            BL_TO_FORTRAN_ANYD((*area[2])[mfi])),
+                                               AMREX_D_DECL(BL_TO_FORTRAN_ANYD(*eb->area[0]),
+                                                            BL_TO_FORTRAN_ANYD(*eb->area[1]),
+                                                            BL_TO_FORTRAN_ANYD(*eb->area[2])),
                                                BL_TO_FORTRAN_ANYD(ccmask[mfi]),
                                                cdr, bct, bcl,
                                                BL_TO_FORTRAN_ANYD(fsfab),
@@ -953,7 +994,7 @@ MLEBABecLap::apply (int amrlev, int mglev, MultiFab& out, MultiFab& in, BCMode b
 {
     BL_PROFILE("MLEBABecLap::apply()");
     applyBC(amrlev, mglev, in, bc_mode, s_mode, bndry);
-    Fapply(amrlev, mglev, out, in);
+    Fapply(amrlev, mglev, out, in, FRegion::all);
 }
 
 void
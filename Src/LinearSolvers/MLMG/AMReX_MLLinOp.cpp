@@ -35,6 +35,7 @@ namespace {
     int flag_comm_cache = 0;
     int flag_use_mota = 0;
     int remap_nbh_lb = 1;
+    int flag_overlap_comm = 0;
 
 #ifdef BL_USE_MPI
     class CommCache
@@ -97,6 +98,7 @@ void MLLinOp::Initialize ()
     pp.query("comm_cache", flag_comm_cache);
     pp.query("mota", flag_use_mota);
     pp.query("remap_nbh_lb", remap_nbh_lb);
+    pp.query("overlap_comm", flag_overlap_comm);
 
 #ifdef BL_USE_MPI
     comm_cache.reset(new CommCache());
@@ -135,12 +137,15 @@ MLLinOp::define (const Vector<Geometry>& a_geom,
     }
 
     info = a_info;
+    if (flag_overlap_comm) {
+        info.overlap_comm = true;
+    }
 #if AMREX_USE_EB
     if (!a_factory.empty()){
         auto f = dynamic_cast<EBFArrayBoxFactory const*>(a_factory[0]);
         if (f) {
             info.max_coarsening_level = std::min(info.max_coarsening_level,
-                                                 f->maxCoarseningLevel());
+                                                 f->maxCoarseningLevel(info.max_coarsening_level));
         }
     }
 #endif
@@ -457,6 +462,32 @@ MLLinOp::make (Vector<Vector<MultiFab> >& mf, int nc, int ng) const
     }
 }
 
+void
+MLLinOp::resetCommStats () const
+{
+    m_comm_time.resize(m_num_amr_levels);
+    m_comm_bytes.resize(m_num_amr_levels);
+    for (int alev = 0; alev < m_num_amr_levels; ++alev)
+    {
+        m_comm_time[alev].assign(m_num_mg_levels[alev], 0.0);
+        m_comm_bytes[alev].assign(m_num_mg_levels[alev], 0L);
+    }
+}
+
+MLLinOp::CommStatsScope::CommStatsScope (const MLLinOp& a_op, int a_amrlev, int a_mglev)
+    : op(a_op), amrlev(a_amrlev), mglev(a_mglev),
+      t0(amrex::second()), b0(FabArrayBase::bytesSent())
+{}
+
+MLLinOp::CommStatsScope::~CommStatsScope ()
+{
+    if (amrlev < op.m_comm_time.size() && mglev < op.m_comm_time[amrlev].size())
+    {
+        op.m_comm_time[amrlev][mglev] += amrex::second() - t0;
+        op.m_comm_bytes[amrlev][mglev] += FabArrayBase::bytesSent() - b0;
+    }
+}
+
 void
 MLLinOp::setDomainBC (const Array<BCType,AMREX_SPACEDIM>& a_lobc,
                       const Array<BCType,AMREX_SPACEDIM>& a_hibc)
@@ -1,3 +1,7 @@
+#include <cmath>
+#include <fstream>
+#include <limits>
+
 #include <AMReX_MLMG.H>
 #include <AMReX_MultiFabUtil.H>
 #include <AMReX_VisMF.H>
@@ -40,6 +44,19 @@
 
 namespace amrex {
 
+namespace {
+
+// Adds the wall time of its scope to *t, unless t is nullptr.
+struct ScopedTimer
+{
+    ScopedTimer (Real* a_t) : t(a_t), t0(a_t ? amrex::second() : 0.0) {}
+    ~ScopedTimer () { if (t) *t += amrex::second() - t0; }
+    Real* t;
+    Real t0;
+};
+
+}
+
 MLMG::MLMG (MLLinOp& a_lp)
     : linop(a_lp),
       namrlevs(a_lp.NAMRLevels()),
@@ -64,40 +81,92 @@ MLMG::solve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab const*>& a_rh
 
     Real solve_start_time = amrex::second();
 
+    const bool do_autotune = autotune && !is_nsolve && do_fixed_number_of_iters == 0;
+    if (do_autotune) autoTuneBegin();
+
     Real composite_norminf;
 
     prepareForSolve(a_sol, a_rhs);
 
+    stats = MLMGStats();
+    if (collect_stats) {
+        stats.levels.resize(namrlevs);
+        for (int alev = 0; alev < namrlevs; ++alev) {
+            stats.levels[alev].resize(linop.NMGLevels(alev));
+        }
+        linop.resetCommStats();
+    }
+
     computeMLResidual(finest_amr_lev);
 
     int ncomp = linop.getNComp();
 
-    bool local = true;
-    Real resnorm0 = MLResNormInf(finest_amr_lev, local); 
-    Real rhsnorm0 = MLRhsNormInf(local); 
+    // Each component is an independent right-hand side with its own
+    // convergence target.  The norms of all the components are
+    // reduced together so that the number of reductions per iteration
+    // does not depend on ncomp.
+    Vector<Real> resnorm0 = MLResNormInfComp(finest_amr_lev);
+    Vector<Real> rhsnorm0 = MLRhsNormInfComp();
     if (!is_nsolve) {
-        ParallelAllReduce::Max<Real>({resnorm0, rhsnorm0}, ParallelContext::CommunicatorSub());
+        Vector<Real> tmp(resnorm0);
+        tmp.insert(tmp.end(), rhsnorm0.begin(), rhsnorm0.end());
+        ParallelAllReduce::Max(tmp.data(), tmp.size(), ParallelContext::CommunicatorSub());
+        std::copy(tmp.begin(), tmp.begin()+ncomp, resnorm0.begin());
+        std::copy(tmp.begin()+ncomp, tmp.end(), rhsnorm0.begin());
+
+        stats.initial_rhs_norm = maxComp(rhsnorm0);
+        stats.initial_res_norm = maxComp(resnorm0);
 
         if (verbose >= 1)
         {
-            amrex::Print() << "MLMG: Initial rhs               = " << rhsnorm0 << "\n"
-                           << "MLMG: Initial residual (resid0) = " << resnorm0 << "\n";
+            amrex::Print() << "MLMG: Initial rhs               = " << maxComp(rhsnorm0) << "\n"
+                           << "MLMG: Initial residual (resid0) = " << maxComp(resnorm0) << "\n";
         }
     }
 
-    Real max_norm;
+    Vector<Real> max_norm(ncomp);
+    Vector<Real> res_target(ncomp);
     std::string norm_name;
-    if (always_use_bnorm or rhsnorm0 >= resnorm0) {
-        norm_name = "bnorm";
-        max_norm = rhsnorm0;
-    } else {
-        norm_name = "resid0";
-        max_norm = resnorm0;
+    for (int n = 0; n < ncomp; ++n)
+    {
+        std::string name;
+        if (always_use_bnorm or rhsnorm0[n] >= resnorm0[n]) {
+            name = "bnorm";
+            max_norm[n] = rhsnorm0[n];
+        } else {
+            name = "resid0";
+            max_norm[n] = resnorm0[n];
+        }
+        if (n == 0) {
+            norm_name = name;
+        } else if (name != norm_name) {
+            norm_name = "norm0";
+        }
+        res_target[n] = std::max(a_tol_abs, std::max(a_tol_rel,1.e-16)*max_norm[n]);
     }
-    const Real res_target = std::max(a_tol_abs, std::max(a_tol_rel,1.e-16)*max_norm);
 
-    if (!is_nsolve && resnorm0 <= res_target) {
-        composite_norminf = resnorm0;
+    // Largest ratio of norm to the reference norm over the components
+    auto relNorm = [&] (const Vector<Real>& norm) -> Real {
+        if (ncomp == 1) return norm[0]/max_norm[0];
+        Real r = 0.0;
+        for (int n = 0; n < ncomp; ++n) {
+            if (max_norm[n] > 0.0) r = std::max(r, norm[n]/max_norm[n]);
+        }
+        return r;
+    };
+
+    auto isConverged = [&] (const Vector<Real>& norm) -> bool {
+        for (int n = 0; n < ncomp; ++n) {
+            if (norm[n] > res_target[n]) return false;
+        }
+        return true;
+    };
+
+    Vector<Real> composite_norm = resnorm0;
+
+    if (!is_nsolve && isConverged(resnorm0)) {
+        composite_norminf = maxComp(resnorm0);
+        stats.converged = true;
         if (verbose >= 1) {
             amrex::Print() << "MLMG: No iterations needed\n";
         }
@@ -111,59 +180,91 @@ MLMG::solve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab const*>& a_rh
             oneIter(iter);
 
             converged = false;
+            stats.num_iters = iter+1;
 
             // Test convergence on the fine amr level
             computeResidual(finest_amr_lev);
 
             if (is_nsolve) continue;
 
-            Real fine_norminf = ResNormInf(finest_amr_lev);
-            composite_norminf = fine_norminf;
+            Vector<Real> fine_norm = ResNormInfComp(finest_amr_lev);
+            ParallelAllReduce::Max(fine_norm.data(), ncomp, ParallelContext::CommunicatorSub());
+            composite_norm = fine_norm;
+            composite_norminf = maxComp(fine_norm);
             if (verbose >= 2) {
                 amrex::Print() << "MLMG: Iteration " << std::setw(3) << iter+1 << " Fine resid/"
-                               << norm_name << " = " << fine_norminf/max_norm << "\n";
+                               << norm_name << " = " << relNorm(fine_norm) << "\n";
             }
-            bool fine_converged = (fine_norminf <= res_target);
+            bool fine_converged = isConverged(fine_norm);
 
             if (namrlevs == 1 and fine_converged) {
                 converged = true;
             } else if (fine_converged) {
                 // finest level is converged, but we still need to test the coarse levels
                 computeMLResidual(finest_amr_lev-1);
-                Real crse_norminf = MLResNormInf(finest_amr_lev-1);
+                Vector<Real> crse_norm = MLResNormInfComp(finest_amr_lev-1);
+                ParallelAllReduce::Max(crse_norm.data(), ncomp, ParallelContext::CommunicatorSub());
                 if (verbose >= 2) {
                     amrex::Print() << "MLMG: Iteration " << std::setw(3) << iter+1
                                    << " Crse resid/" << norm_name << " = "
-                                   << crse_norminf/max_norm << "\n";
+                                   << relNorm(crse_norm) << "\n";
                 }
-                converged = (crse_norminf <= res_target);
-                composite_norminf = std::max(fine_norminf, crse_norminf);
+                converged = isConverged(crse_norm);
+                for (int n = 0; n < ncomp; ++n) {
+                    composite_norm[n] = std::max(fine_norm[n], crse_norm[n]);
+                }
+                composite_norminf = maxComp(composite_norm);
             } else {
                 converged = false;
             }
 
+            stats.res_history.push_back(composite_norminf);
+
+            if (verbose >= 3 && ncomp > 1) {
+                for (int n = 0; n < ncomp; ++n) {
+                    amrex::Print() << "MLMG: Iteration " << std::setw(3) << iter+1
+                                   << " Component " << n << " resid = " << composite_norm[n]
+                                   << (composite_norm[n] <= res_target[n] ? " (converged)" : "")
+                                   << "\n";
+                }
+            }
+
             if (converged) {
                 if (verbose >= 1) {
                     amrex::Print() << "MLMG: Final Iter. " << iter+1
                                    << " resid, resid/" << norm_name << " = "
                                    << composite_norminf << ", "
-                                   << composite_norminf/max_norm << "\n";
+                                   << relNorm(composite_norm) << "\n";
                 }
                 break;
             }
+
+            if (do_autotune && tune_index > 0 && iter+1 == max_iters/2) {
+                // The candidate on trial converges too slowly.  Finish
+                // the solve with the baseline parameters.
+                useTuneCandidate(tune_candidates[0]);
+                tune_failed = true;
+            }
         }
+        stats.converged = converged;
+        timer[iter_time] = amrex::second() - iter_start_time;
         if (!converged && do_fixed_number_of_iters == 0) {
             if (verbose > 0) {
                 amrex::Print() << "MLMG: Failed to converge after " << max_iters << " iterations."
                                << " resid, resid/" << norm_name << " = "
                                << composite_norminf << ", "
-                               << composite_norminf/max_norm << "\n";
+                               << relNorm(composite_norm) << "\n";
             }
+            timer[solve_time] = amrex::second() - solve_start_time;
+            stats.final_res_norm = composite_norminf;
+            finalizeStats();
             amrex::Abort("MLMG failed");
         }
-        timer[iter_time] = amrex::second() - iter_start_time;
     }
 
+    final_resnorm = composite_norm;
+    stats.final_res_norm = composite_norminf;
+
     int ng_back = final_fill_bc ? 1 : 0;
     for (int alev = 0; alev < namrlevs; ++alev)
     {
@@ -174,6 +275,8 @@ MLMG::solve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab const*>& a_rh
     }
 
     timer[solve_time] = amrex::second() - solve_start_time;
+    finalizeStats();
+    if (do_autotune) autoTuneEnd(stats.num_iters > 0);
     if (verbose >= 1) {
         ParallelReduce::Max<Real>(timer.data(), timer.size(), 0,
                                   ParallelContext::CommunicatorSub());
@@ -232,7 +335,11 @@ void MLMG::oneIter (int iter)
     for (int alev = 1; alev <= finest_amr_lev; ++alev)
     {
         // (Fine AMR correction) = I(Coarse AMR correction)
-        interpCorrection(alev);
+        {
+            MLMGStats::LevelStats* ls = levelStats(alev, 0);
+            ScopedTimer st(ls ? &ls->interpolation_time : nullptr);
+            interpCorrection(alev);
+        }
 
         MultiFab::Add(*sol[alev], *cor[alev][0], 0, 0, ncomp, 0);
 
@@ -319,6 +426,8 @@ MLMG::computeResWithCrseSolFineCor (int calev, int falev)
     linop.reflux(calev, crse_res, crse_sol, crse_rhs, fine_res, fine_sol, fine_rhs);
 
     if (linop.isCellCentered()) {
+        MLMGStats::LevelStats* ls = levelStats(falev, 0);
+        ScopedTimer st(ls ? &ls->restriction_time : nullptr);
         const int amrrr = linop.AMRRefRatio(calev);
 #ifdef AMREX_USE_EB
         amrex::EB_average_down(fine_res, crse_res, 0, ncomp, amrrr);
@@ -396,12 +505,18 @@ MLMG::mgVcycle (int amrlev, int mglev_top)
                            << "   DN: Norm before smooth " << norm << "\n";
         }
 
+        MLMGStats::LevelStats* ls = levelStats(amrlev, mglev);
+
         cor[amrlev][mglev]->setVal(0.0);
-        bool skip_fillboundary = true;
-        for (int i = 0; i < nu1; ++i) {
-            linop.smooth(amrlev, mglev, *cor[amrlev][mglev], res[amrlev][mglev],
-                         skip_fillboundary);
-            skip_fillboundary = false;
+        {
+            ScopedTimer st(ls ? &ls->smooth_time : nullptr);
+            bool skip_fillboundary = true;
+            for (int i = 0; i < nu1; ++i) {
+                linop.smooth(amrlev, mglev, *cor[amrlev][mglev], res[amrlev][mglev],
+                             skip_fillboundary);
+                skip_fillboundary = false;
+            }
+            if (ls) ls->num_smooths += nu1;
         }
 
         // rescor = res - L(cor)
@@ -415,7 +530,10 @@ MLMG::mgVcycle (int amrlev, int mglev_top)
         }
 
         // res_crse = R(rescor_fine); this provides res/b to the level below
-        linop.restriction(amrlev, mglev+1, res[amrlev][mglev+1], rescor[amrlev][mglev]);
+        {
+            ScopedTimer st(ls ? &ls->restriction_time : nullptr);
+            linop.restriction(amrlev, mglev+1, res[amrlev][mglev+1], rescor[amrlev][mglev]);
+        }
 
     }
 
@@ -445,12 +563,17 @@ MLMG::mgVcycle (int amrlev, int mglev_top)
             amrex::Print() << "AT LEVEL "  << amrlev << " " << mglev_bottom 
                            << "       Norm before smooth " << norm << "\n";
         }
+        MLMGStats::LevelStats* ls = levelStats(amrlev, mglev_bottom);
         cor[amrlev][mglev_bottom]->setVal(0.0);
-        bool skip_fillboundary = true;
-        for (int i = 0; i < nu1; ++i) {
-            linop.smooth(amrlev, mglev_bottom, *cor[amrlev][mglev_bottom], res[amrlev][mglev_bottom],
-                         skip_fillboundary);
-            skip_fillboundary = false;
+        {
+            ScopedTimer st(ls ? &ls->smooth_time : nullptr);
+            bool skip_fillboundary = true;
+            for (int i = 0; i < nu1; ++i) {
+                linop.smooth(amrlev, mglev_bottom, *cor[amrlev][mglev_bottom], res[amrlev][mglev_bottom],
+                             skip_fillboundary);
+                skip_fillboundary = false;
+            }
+            if (ls) ls->num_smooths += nu1;
         }
         if (verbose >= 4)
         {
@@ -466,8 +589,12 @@ MLMG::mgVcycle (int amrlev, int mglev_top)
     {
         std::string blp_mgv_up_lev_str = make_str("MLMG::mgVcycle_up::", mglev);
         BL_PROFILE_VAR(blp_mgv_up_lev_str, blp_mgv_up_lev);
+        MLMGStats::LevelStats* ls = levelStats(amrlev, mglev);
         // cor_fine += I(cor_crse)
-        addInterpCorrection(amrlev, mglev);
+        {
+            ScopedTimer st(ls ? &ls->interpolation_time : nullptr);
+            addInterpCorrection(amrlev, mglev);
+        }
         if (verbose >= 4)
         {
             computeResOfCorrection(amrlev, mglev);
@@ -475,8 +602,12 @@ MLMG::mgVcycle (int amrlev, int mglev_top)
             amrex::Print() << "AT LEVEL "  << amrlev << " " << mglev
                            << "   UP: Norm before smooth " << norm << "\n";
         }
-        for (int i = 0; i < nu2; ++i) {
-            linop.smooth(amrlev, mglev, *cor[amrlev][mglev], res[amrlev][mglev]);
+        {
+            ScopedTimer st(ls ? &ls->smooth_time : nullptr);
+            for (int i = 0; i < nu2; ++i) {
+                linop.smooth(amrlev, mglev, *cor[amrlev][mglev], res[amrlev][mglev]);
+            }
+            if (ls) ls->num_smooths += nu2;
         }
         if (verbose >= 4)
         {
@@ -503,6 +634,8 @@ MLMG::mgFcycle ()
 
     for (int mglev = 1; mglev <= mg_bottom_lev; ++mglev)
     {
+        MLMGStats::LevelStats* ls = levelStats(amrlev, mglev-1);
+        ScopedTimer st(ls ? &ls->restriction_time : nullptr);
         // TODO: for EB cell-centered, we need to use EB_average_down
         amrex::average_down(res[amrlev][mglev-1], res[amrlev][mglev], 0, ncomp, ratio);
     }
@@ -512,7 +645,11 @@ MLMG::mgFcycle ()
     for (int mglev = mg_bottom_lev-1; mglev >= 0; --mglev)
     {
         // cor_fine = I(cor_crse)
-        interpCorrection (amrlev, mglev);
+        {
+            MLMGStats::LevelStats* ls = levelStats(amrlev, mglev);
+            ScopedTimer st(ls ? &ls->interpolation_time : nullptr);
+            interpCorrection (amrlev, mglev);
+        }
 
         // rescor = res - L(cor)
         computeResOfCorrection(amrlev, mglev);
@@ -819,6 +956,8 @@ MLMG::actualBottomSolve ()
 
     Real bottom_start_time = amrex::second();
 
+    ++stats.num_bottom_solves;
+
     ParallelContext::push(linop.BottomCommunicator());
 
     const int amrlev = 0;
@@ -836,6 +975,7 @@ MLMG::actualBottomSolve ()
             linop.smooth(amrlev, mglev, x, b, skip_fillboundary);
             skip_fillboundary = false;
         }
+        stats.num_bottom_iters += nuf;
     }
     else
     {
@@ -873,6 +1013,7 @@ MLMG::actualBottomSolve ()
             const Real cg_rtol = bottom_reltol;
             const Real cg_atol = -1.0;
             int ret = cg_solver.solve(x, *bottom_b, cg_rtol, cg_atol);
+            stats.num_bottom_iters += cg_solver.getNumIters();
             if (ret != 0 && verbose > 1) {
                 amrex::Print() << "MLMG: Bottom solve failed.\n";
             }
@@ -891,14 +1032,14 @@ MLMG::actualBottomSolve ()
     timer[bottom_time] += amrex::second() - bottom_start_time;
 }
 
-// Compute single-level masked inf-norm of Residual (res).
-Real
-MLMG::ResNormInf (int alev, bool local)
+// Compute single-level masked inf-norm of Residual (res) for each component.
+Vector<Real>
+MLMG::ResNormInfComp (int alev)
 {
-    BL_PROFILE("MLMG::ResNormInf()");
+    BL_PROFILE("MLMG::ResNormInfComp()");
     const int ncomp = linop.getNComp();
     const int mglev = 0;
-    Real norm = 0.0;
+    Vector<Real> norm(ncomp, 0.0);
     MultiFab* pmf = &(res[alev][mglev]);
 #ifdef AMREX_USE_EB
     if (linop.isCellCentered() && scratch[alev]) {
@@ -913,39 +1054,58 @@ MLMG::ResNormInf (int alev, bool local)
 #endif
     for (int n = 0; n < ncomp; n++)
     {
-	Real newnorm = 0.0;
 	if (fine_mask[alev]) {
-            newnorm = pmf->norm0(*fine_mask[alev],n,0,true);
+            norm[n] = pmf->norm0(*fine_mask[alev],n,0,true);
 	} else {
-            newnorm = pmf->norm0(n,0,true);
+            norm[n] = pmf->norm0(n,0,true);
 	}
-	if (newnorm > norm) norm = newnorm;
     }
+    return norm;
+}
+
+// Compute single-level masked inf-norm of Residual (res).
+Real
+MLMG::ResNormInf (int alev, bool local)
+{
+    BL_PROFILE("MLMG::ResNormInf()");
+    Real norm = maxComp(ResNormInfComp(alev));
     if (!local) ParallelAllReduce::Max(norm, ParallelContext::CommunicatorSub());
     return norm;
 }
 
+// Computes multi-level masked inf-norm of Residual (res) for each component.
+Vector<Real>
+MLMG::MLResNormInfComp (int alevmax)
+{
+    BL_PROFILE("MLMG::MLResNormInfComp()");
+    Vector<Real> r(linop.getNComp(), 0.0);
+    for (int alev = 0; alev <= alevmax; ++alev)
+    {
+        const Vector<Real>& lev_norm = ResNormInfComp(alev);
+        for (int n = 0; n < r.size(); ++n) {
+            r[n] = std::max(r[n], lev_norm[n]);
+        }
+    }
+    return r;
+}
+
 // Computes multi-level masked inf-norm of Residual (res).
 Real
 MLMG::MLResNormInf (int alevmax, bool local)
 {
     BL_PROFILE("MLMG::MLResNormInf()");
-    Real r = 0.0;
-    for (int alev = 0; alev <= alevmax; ++alev)
-    {
-        r = std::max(r, ResNormInf(alev,true));
-    }
+    Real r = maxComp(MLResNormInfComp(alevmax));
     if (!local) ParallelAllReduce::Max(r, ParallelContext::CommunicatorSub());
     return r;
 }
 
-// Compute multi-level masked inf-norm of RHS (rhs).
-Real
-MLMG::MLRhsNormInf (bool local)
+// Compute multi-level masked inf-norm of RHS (rhs) for each component.
+Vector<Real>
+MLMG::MLRhsNormInfComp ()
 {
-    BL_PROFILE("MLMG::MLRhsNormInf()");
+    BL_PROFILE("MLMG::MLRhsNormInfComp()");
     const int ncomp = linop.getNComp();
-    Real r = 0.0;
+    Vector<Real> r(ncomp, 0.0);
     for (int alev = 0; alev <= finest_amr_lev; ++alev)
     {
         MultiFab* pmf = &(rhs[alev]);
@@ -963,16 +1123,35 @@ MLMG::MLRhsNormInf (bool local)
         for (int n=0; n<ncomp; ++n)
         {
             if (alev < finest_amr_lev) {
-                r = std::max(r, pmf->norm0(*fine_mask[alev],n,0,true));
+                r[n] = std::max(r[n], pmf->norm0(*fine_mask[alev],n,0,true));
             } else {
-                r = std::max(r, pmf->norm0(n,0,true));
+                r[n] = std::max(r[n], pmf->norm0(n,0,true));
             }
         }
     }
+    return r;
+}
+
+// Compute multi-level masked inf-norm of RHS (rhs).
+Real
+MLMG::MLRhsNormInf (bool local)
+{
+    BL_PROFILE("MLMG::MLRhsNormInf()");
+    Real r = maxComp(MLRhsNormInfComp());
     if (!local) ParallelAllReduce::Max(r, ParallelContext::CommunicatorSub());
     return r;
 }
 
+Real
+MLMG::maxComp (const Vector<Real>& v)
+{
+    Real r = 0.0;
+    for (auto x : v) {
+        r = std::max(r, x);
+    }
+    return r;
+}
+
 void
 MLMG::buildFineMask ()
 {
@@ -1046,11 +1225,13 @@ MLMG::prepareForSolve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab con
     petsc_bndry.reset(); 
 #endif
 
+    const int ng_sol = linop.getNGrow();
+
     sol.resize(namrlevs);
     sol_raii.resize(namrlevs);
     for (int alev = 0; alev < namrlevs; ++alev)
     {
-        if (a_sol[alev]->nGrow() == 1)
+        if (a_sol[alev]->nGrow() == ng_sol)
         {
             sol[alev] = a_sol[alev];
         }
@@ -1058,7 +1239,7 @@ MLMG::prepareForSolve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab con
         {
             if (!solve_called) {
                 sol_raii[alev].reset(new MultiFab(a_sol[alev]->boxArray(),
-                                                  a_sol[alev]->DistributionMap(), ncomp, 1,
+                                                  a_sol[alev]->DistributionMap(), ncomp, ng_sol,
                                                   MFInfo(), *linop.Factory(alev)));
             }
             sol_raii[alev]->setVal(0.0);
@@ -1114,7 +1295,7 @@ MLMG::prepareForSolve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab con
         }
     }
 
-    ng = 1;
+    ng = ng_sol;
     cor.resize(namrlevs);
     for (int alev = 0; alev <= finest_amr_lev; ++alev)
     {
@@ -1179,6 +1360,7 @@ MLMG::prepareForSolve (const Vector<MultiFab*>& a_sol, const Vector<MultiFab con
     }
 
     if (linop.m_parent) do_nsolve = false;  // no embeded N-Solve
+    if (ncomp > 1) do_nsolve = false;
     if (linop.m_domain_covered[0]) do_nsolve = false;
     if (linop.doAgglomeration()) do_nsolve = false;
     if (AMREX_SPACEDIM != 3) do_nsolve = false;
@@ -1223,6 +1405,168 @@ MLMG::prepareForNSolve ()
     ns_mlmg->setBottomSolver(BottomSolver::smoother);
 }
 
+void
+MLMG::useTuneCandidate (const TuneCandidate& c)
+{
+    nu1 = c.nu1;
+    nu2 = c.nu2;
+    max_fmg_iters = c.max_fmg_iters;
+    bottom_solver = c.bottom_solver;
+}
+
+void
+MLMG::autoTuneBegin ()
+{
+    if (tune_candidates.empty())
+    {
+        const TuneCandidate base {nu1, nu2, max_fmg_iters, bottom_solver, 0.0, 0.0};
+        Vector<TuneCandidate> cands {base};
+        auto add = [&] (int a_nu1, int a_nu2, int a_fmg, BottomSolver a_bottom) {
+            for (const auto& c : cands) {
+                if (c.nu1 == a_nu1 && c.nu2 == a_nu2 && c.max_fmg_iters == a_fmg
+                    && c.bottom_solver == a_bottom) return;
+            }
+            cands.push_back({a_nu1, a_nu2, a_fmg, a_bottom, 0.0, 0.0});
+        };
+        add(1, 1, base.max_fmg_iters, base.bottom_solver);
+        add(3, 3, base.max_fmg_iters, base.bottom_solver);
+        add(base.nu1, base.nu2, max_iters, base.bottom_solver);
+        // cg needs a symmetric operator, and hypre and petsc may not be built.
+        add(base.nu1, base.nu2, base.max_fmg_iters, BottomSolver::bicgstab);
+        add(base.nu1, base.nu2, base.max_fmg_iters, BottomSolver::smoother);
+        tune_candidates = std::move(cands);
+        tune_index = 0;
+    }
+
+    if (tune_index >= 0) {
+        useTuneCandidate(tune_candidates[tune_index]);
+        tune_failed = false;
+    }
+}
+
+void
+MLMG::autoTuneEnd (bool iterated)
+{
+    // Nothing to learn from a solve without iterations.
+    if (!iterated) return;
+
+    const Real factor = stats.convergenceFactor();
+
+    if (tune_index < 0)
+    {
+        if (factor > 0.0 && tune_ref_factor > 0.0
+            && std::log(factor) > 0.5*std::log(tune_ref_factor))
+        {
+            if (verbose >= 1) {
+                amrex::Print() << "MLMG: Convergence factor went from " << tune_ref_factor
+                               << " to " << factor << ", auto-tuning again\n";
+            }
+            tune_index = 0;
+        }
+        return;
+    }
+
+    // The solve time would include the setup in prepareForSolve, which
+    // is done once on the first solve, i.e., for the first candidate.
+    Real t = timer[iter_time];
+    ParallelAllReduce::Max(t, ParallelContext::CommunicatorSub());
+    // A zero residual is as good as machine precision.
+    const Real max_digits = -std::log10(std::numeric_limits<Real>::epsilon());
+    const Real digits = (stats.final_res_norm > 0.0)
+        ? std::min(std::log10(stats.initial_res_norm/stats.final_res_norm), max_digits)
+        : max_digits;
+
+    TuneCandidate& c = tune_candidates[tune_index];
+    c.factor = factor;
+    c.cost = tune_failed ? std::numeric_limits<Real>::max() : t/std::max(digits, 0.1);
+
+    if (++tune_index < tune_candidates.size()) return;
+
+    tune_index = -1;
+    int ibest = 0;
+    for (int i = 1; i < tune_candidates.size(); ++i) {
+        if (tune_candidates[i].cost < tune_candidates[ibest].cost) ibest = i;
+    }
+    const TuneCandidate& best = tune_candidates[ibest];
+    useTuneCandidate(best);
+    tune_ref_factor = best.factor;
+
+    if (verbose >= 1) {
+        amrex::Print() << "MLMG: Auto-tune picked nu1 = " << best.nu1 << ", nu2 = " << best.nu2
+                       << ", max_fmg_iters = " << best.max_fmg_iters
+                       << ", bottom_solver = " << static_cast<int>(best.bottom_solver)
+                       << " (" << best.cost << " seconds per digit)\n";
+    }
+}
+
+MLMGStats::LevelStats*
+MLMG::levelStats (int amrlev, int mglev)
+{
+    return collect_stats ? &stats.levels[amrlev][mglev] : nullptr;
+}
+
+// Gather the per-level statistics over the processes and write the
+// statistics file.
+void
+MLMG::finalizeStats ()
+{
+    BL_PROFILE("MLMG::finalizeStats()");
+
+    if (!collect_stats) return;
+
+    stats.solve_time  = timer[solve_time];
+    stats.iter_time   = timer[iter_time];
+    stats.bottom_time = timer[bottom_time];
+
+    // Processes not in the bottom communicator have no bottom counts.
+    Vector<Real> tmax {stats.solve_time, stats.iter_time, stats.bottom_time};
+    Vector<long> lmax {stats.num_bottom_solves, stats.num_bottom_iters};
+    Vector<long> lsum;
+    for (int alev = 0; alev < namrlevs; ++alev) {
+        for (int mglev = 0; mglev < stats.levels[alev].size(); ++mglev) {
+            MLMGStats::LevelStats& ls = stats.levels[alev][mglev];
+            ls.comm_time  = linop.m_comm_time[alev][mglev];
+            ls.comm_bytes = linop.m_comm_bytes[alev][mglev];
+            tmax.push_back(ls.smooth_time);
+            tmax.push_back(ls.restriction_time);
+            tmax.push_back(ls.interpolation_time);
+            tmax.push_back(ls.comm_time);
+            lsum.push_back(ls.comm_bytes);
+        }
+    }
+
+    MPI_Comm comm = ParallelContext::CommunicatorSub();
+    ParallelAllReduce::Max(tmax.data(), tmax.size(), comm);
+    ParallelAllReduce::Max(lmax.data(), lmax.size(), comm);
+    ParallelAllReduce::Sum(lsum.data(), lsum.size(), comm);
+
+    stats.solve_time  = tmax[0];
+    stats.iter_time   = tmax[1];
+    stats.bottom_time = tmax[2];
+    stats.num_bottom_solves = lmax[0];
+    stats.num_bottom_iters  = lmax[1];
+    int it = 3, il = 0;
+    for (int alev = 0; alev < namrlevs; ++alev) {
+        for (auto& ls : stats.levels[alev]) {
+            ls.smooth_time        = tmax[it++];
+            ls.restriction_time   = tmax[it++];
+            ls.interpolation_time = tmax[it++];
+            ls.comm_time          = tmax[it++];
+            ls.comm_bytes         = lsum[il++];
+        }
+    }
+
+    if (!stats_file.empty() && ParallelContext::IOProcessorSub())
+    {
+        std::ofstream ofs(stats_file, std::ios::app);
+        if (!ofs.good()) {
+            amrex::FileOpenFailed(stats_file);
+        }
+        stats.writeJSON(ofs);
+        ofs << "\n";
+    }
+}
+
 void
 MLMG::getGradSolution (const Vector<Array<MultiFab*,AMREX_SPACEDIM> >& a_grad_sol,
                        Location a_loc)
@@ -1303,12 +1647,13 @@ MLMG::compResidual (const Vector<MultiFab*>& a_res, const Vector<MultiFab*>& a_s
     BL_PROFILE("MLMG::compResidual()");
 
     const int ncomp = linop.getNComp();
+    const int ng_sol = linop.getNGrow();
    
     sol.resize(namrlevs);
     sol_raii.resize(namrlevs);
     for (int alev = 0; alev < namrlevs; ++alev)
     {
-        if (a_sol[alev]->nGrow() == 1)
+        if (a_sol[alev]->nGrow() == ng_sol)
         {
             sol[alev] = a_sol[alev];
         }
@@ -1317,7 +1662,7 @@ MLMG::compResidual (const Vector<MultiFab*>& a_res, const Vector<MultiFab*>& a_s
             if (sol_raii[alev] == nullptr)
             {
                 sol_raii[alev].reset(new MultiFab(a_sol[alev]->boxArray(),
-                                                  a_sol[alev]->DistributionMap(), ncomp, 1,
+                                                  a_sol[alev]->DistributionMap(), ncomp, ng_sol,
                                                   MFInfo(), *linop.Factory(alev)));
             }
             MultiFab::Copy(*sol_raii[alev], *a_sol[alev], 0, 0, ncomp, 0);
@@ -1375,9 +1720,11 @@ MLMG::apply (const Vector<MultiFab*>& out, const Vector<MultiFab*>& a_in)
     Vector<MultiFab> in_raii(namrlevs);
     Vector<MultiFab> rh(namrlevs);
 
+    const int ng_in = linop.getNGrow();
+
     for (int alev = 0; alev < namrlevs; ++alev)
     {
-        if (a_in[alev]->nGrow() == 1)
+        if (a_in[alev]->nGrow() == ng_in)
         {
             in[alev] = a_in[alev];
         }
@@ -1385,7 +1732,7 @@ MLMG::apply (const Vector<MultiFab*>& out, const Vector<MultiFab*>& a_in)
         {
             in_raii[alev].define(a_in[alev]->boxArray(),
                                  a_in[alev]->DistributionMap(),
-                                 a_in[alev]->nComp(), 1,
+                                 a_in[alev]->nComp(), ng_in,
                                  MFInfo(), *linop.Factory(alev));
             MultiFab::Copy(in_raii[alev], *a_in[alev], 0, 0, a_in[alev]->nComp(), 0);
             in[alev] = &(in_raii[alev]);
@@ -0,0 +1,90 @@
+
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <ostream>
+
+#include <AMReX_MLMGStats.H>
+
+namespace amrex {
+
+Real
+MLMGStats::convergenceFactor () const
+{
+    if (num_iters == 0 || initial_res_norm <= 0.0 || res_history.empty()) return 0.0;
+    return std::pow(res_history.back()/initial_res_norm, 1.0/res_history.size());
+}
+
+long
+MLMGStats::commBytes () const
+{
+    long r = 0;
+    for (const auto& amrlev : levels) {
+        for (const auto& lev : amrlev) {
+            r += lev.comm_bytes;
+        }
+    }
+    return r;
+}
+
+namespace {
+    // JSON has no inf or nan
+    struct JReal {
+        Real v;
+        JReal (Real a_v) : v(a_v) {}
+    };
+    std::ostream& operator<< (std::ostream& os, const JReal& x) {
+        if (std::isfinite(x.v)) {
+            os << x.v;
+        } else {
+            os << "null";
+        }
+        return os;
+    }
+}
+
+void
+MLMGStats::writeJSON (std::ostream& os) const
+{
+    const auto oldprec = os.precision(std::numeric_limits<Real>::digits10);
+
+    os << "{\"num_iters\":" << num_iters
+       << ",\"converged\":" << (converged ? "true" : "false")
+       << ",\"initial_rhs_norm\":" << JReal(initial_rhs_norm)
+       << ",\"initial_res_norm\":" << JReal(initial_res_norm)
+       << ",\"final_res_norm\":" << JReal(final_res_norm)
+       << ",\"convergence_factor\":" << JReal(convergenceFactor())
+       << ",\"res_history\":[";
+    for (int i = 0; i < res_history.size(); ++i) {
+        if (i > 0) os << ",";
+        os << JReal(res_history[i]);
+    }
+    os << "],\"solve_time\":" << JReal(solve_time)
+       << ",\"iter_time\":" << JReal(iter_time)
+       << ",\"bottom_time\":" << JReal(bottom_time)
+       << ",\"num_bottom_solves\":" << num_bottom_solves
+       << ",\"num_bottom_iters\":" << num_bottom_iters
+       << ",\"comm_bytes\":" << commBytes()
+       << ",\"levels\":[";
+    bool first = true;
+    for (int amrlev = 0; amrlev < levels.size(); ++amrlev) {
+        for (int mglev = 0; mglev < levels[amrlev].size(); ++mglev) {
+            const LevelStats& s = levels[amrlev][mglev];
+            if (!first) os << ",";
+            first = false;
+            os << "{\"amrlev\":" << amrlev
+               << ",\"mglev\":" << mglev
+               << ",\"num_smooths\":" << s.num_smooths
+               << ",\"smooth_time\":" << JReal(s.smooth_time)
+               << ",\"restriction_time\":" << JReal(s.restriction_time)
+               << ",\"interpolation_time\":" << JReal(s.interpolation_time)
+               << ",\"comm_time\":" << JReal(s.comm_time)
+               << ",\"comm_bytes\":" << s.comm_bytes << "}";
+        }
+    }
+    os << "]}";
+
+    os.precision(oldprec);
+}
+
+}
@@ -1515,6 +1515,7 @@ MLNodeLaplacian::applyBC (int amrlev, int mglev, MultiFab& phi, BCMode/* bc_mode
     const Box& nd_domain = amrex::surroundingNodes(geom.Domain());
 
     if (!skip_fillboundary) {
+        CommStatsScope css(*this, amrlev, mglev);
         phi.FillBoundary(geom.periodicity());
     }
 
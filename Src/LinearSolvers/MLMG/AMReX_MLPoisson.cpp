@@ -9,9 +9,10 @@ MLPoisson::MLPoisson (const Vector<Geometry>& a_geom,
                       const Vector<BoxArray>& a_grids,
                       const Vector<DistributionMapping>& a_dmap,
                       const LPInfo& a_info,
-                      const Vector<FabFactory<FArrayBox> const*>& a_factory)
+                      const Vector<FabFactory<FArrayBox> const*>& a_factory,
+                      int a_ncomp)
 {
-    define(a_geom, a_grids, a_dmap, a_info, a_factory);
+    define(a_geom, a_grids, a_dmap, a_info, a_factory, a_ncomp);
 }
 
 void
@@ -19,9 +20,12 @@ MLPoisson::define (const Vector<Geometry>& a_geom,
                    const Vector<BoxArray>& a_grids,
                    const Vector<DistributionMapping>& a_dmap,
                    const LPInfo& a_info,
-                   const Vector<FabFactory<FArrayBox> const*>& a_factory)
+                   const Vector<FabFactory<FArrayBox> const*>& a_factory,
+                   int a_ncomp)
 {
     BL_PROFILE("MLPoisson::define()");
+    AMREX_ALWAYS_ASSERT(a_ncomp >= 1);
+    m_ncomp = a_ncomp;
     MLCellABecLap::define(a_geom, a_grids, a_dmap, a_info, a_factory);
 }
 
@@ -52,7 +56,8 @@ MLPoisson::prepareForSolve ()
 }
 
 void
-MLPoisson::Fapply (int amrlev, int mglev, MultiFab& out, const MultiFab& in) const
+MLPoisson::Fapply (int amrlev, int mglev, MultiFab& out, const MultiFab& in,
+                   FRegion region) const
 {
     BL_PROFILE("MLPoisson::Fapply()");
 
@@ -63,7 +68,6 @@ MLPoisson::Fapply (int amrlev, int mglev, MultiFab& out, const MultiFab& in) con
 #endif
     for (MFIter mfi(out, true); mfi.isValid(); ++mfi)
     {
-        const Box& bx = mfi.tilebox();
         const FArrayBox& xfab = in[mfi];
         FArrayBox& yfab = out[mfi];
 
@@ -73,13 +77,19 @@ MLPoisson::Fapply (int amrlev, int mglev, MultiFab& out, const MultiFab& in) con
         const auto& re = mfac.cellEdges(mfi);
         const Box& vbx = mfi.validbox();
 #endif
-        amrex_mlpoisson_adotx(BL_TO_FORTRAN_BOX(bx),
-                              BL_TO_FORTRAN_ANYD(yfab),
-                              BL_TO_FORTRAN_ANYD(xfab),
+        for (const Box& bx : regionBoxes(mfi, region))
+        {
+            for (int n = 0; n < m_ncomp; ++n)
+            {
+                amrex_mlpoisson_adotx(BL_TO_FORTRAN_BOX(bx),
+                                      BL_TO_FORTRAN_N_ANYD(yfab,n),
+                                      BL_TO_FORTRAN_N_ANYD(xfab,n),
 #if (AMREX_SPACEDIM != 3)
-                              rc.data(), re.data(), vbx.loVect(), vbx.hiVect(),
+                                      rc.data(), re.data(), vbx.loVect(), vbx.hiVect(),
 #endif
-                              dxinv);                                         
+                                      dxinv);
+            }
+        }
     }
 }
 
@@ -103,16 +113,20 @@ MLPoisson::normalize (int amrlev, int mglev, MultiFab& mf) const
         const auto& rc = mfac.cellCenters(mfi);
         const auto& re = mfac.cellEdges(mfi);
         const Box& vbx = mfi.validbox();
-        amrex_mlpoisson_normalize(BL_TO_FORTRAN_BOX(bx),
-                                  BL_TO_FORTRAN_ANYD(fab),
-                                  rc.data(), re.data(), vbx.loVect(), vbx.hiVect(),
-                                  dxinv);                                     
+        for (int n = 0; n < m_ncomp; ++n)
+        {
+            amrex_mlpoisson_normalize(BL_TO_FORTRAN_BOX(bx),
+                                      BL_TO_FORTRAN_N_ANYD(fab,n),
+                                      rc.data(), re.data(), vbx.loVect(), vbx.hiVect(),
+                                      dxinv);
+        }
     }
 #endif
 }
 
 void
-MLPoisson::Fsmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs, int redblack) const
+MLPoisson::Fsmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs, int redblack,
+                    FRegion region) const
 {
     BL_PROFILE("MLPoisson::Fsmooth()");
 
@@ -162,7 +176,6 @@ MLPoisson::Fsmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs, i
 #endif
 #endif
 
-	const Box&       tbx     = mfi.tilebox();
         const Box&       vbx     = mfi.validbox();
         FArrayBox&       solnfab = sol[mfi];
         const FArrayBox& rhsfab  = rhs[mfi];
@@ -178,60 +191,64 @@ MLPoisson::Fsmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs, i
 #endif
 #endif
 
-#if (AMREX_SPACEDIM == 1)
+#if (AMREX_SPACEDIM != 3)
         const auto& mfac = *m_metric_factor[amrlev][mglev];
         const auto& rc = mfac.cellCenters(mfi);
         const auto& re = mfac.cellEdges(mfi);
-        
-        amrex_mlpoisson_gsrb(BL_TO_FORTRAN_BOX(tbx),
-                             BL_TO_FORTRAN_ANYD(solnfab),
-                             BL_TO_FORTRAN_ANYD(rhsfab),
-                             BL_TO_FORTRAN_ANYD(f0fab),
-                             BL_TO_FORTRAN_ANYD(f1fab),
-                             BL_TO_FORTRAN_ANYD(m0),
-                             BL_TO_FORTRAN_ANYD(m1),
-                             rc.data(), re.data(),
-                             BL_TO_FORTRAN_BOX(vbx), dxinv, redblack);            
+#endif
+
+        for (const Box& tbx : regionBoxes(mfi, region))
+        {
+            for (int n = 0; n < m_ncomp; ++n)
+            {
+#if (AMREX_SPACEDIM == 1)
+                amrex_mlpoisson_gsrb(BL_TO_FORTRAN_BOX(tbx),
+                                     BL_TO_FORTRAN_N_ANYD(solnfab,n),
+                                     BL_TO_FORTRAN_N_ANYD(rhsfab,n),
+                                     BL_TO_FORTRAN_ANYD(f0fab),
+                                     BL_TO_FORTRAN_ANYD(f1fab),
+                                     BL_TO_FORTRAN_ANYD(m0),
+                                     BL_TO_FORTRAN_ANYD(m1),
+                                     rc.data(), re.data(),
+                                     BL_TO_FORTRAN_BOX(vbx), dxinv, redblack);
 #endif
 
 #if (AMREX_SPACEDIM == 2)
-        const auto& mfac = *m_metric_factor[amrlev][mglev];
-        const auto& rc = mfac.cellCenters(mfi);
-        const auto& re = mfac.cellEdges(mfi);
-        
-        amrex_mlpoisson_gsrb(BL_TO_FORTRAN_BOX(tbx),
-                             BL_TO_FORTRAN_ANYD(solnfab),
-                             BL_TO_FORTRAN_ANYD(rhsfab),
-                             BL_TO_FORTRAN_ANYD(f0fab),
-                             BL_TO_FORTRAN_ANYD(f1fab),
-                             BL_TO_FORTRAN_ANYD(f2fab),
-                             BL_TO_FORTRAN_ANYD(f3fab),
-                             BL_TO_FORTRAN_ANYD(m0),
-                             BL_TO_FORTRAN_ANYD(m1),
-                             BL_TO_FORTRAN_ANYD(m2),
-                             BL_TO_FORTRAN_ANYD(m3),
-                             rc.data(), re.data(),
-                             BL_TO_FORTRAN_BOX(vbx), dxinv, redblack);            
+                amrex_mlpoisson_gsrb(BL_TO_FORTRAN_BOX(tbx),
+                                     BL_TO_FORTRAN_N_ANYD(solnfab,n),
+                                     BL_TO_FORTRAN_N_ANYD(rhsfab,n),
+                                     BL_TO_FORTRAN_ANYD(f0fab),
+                                     BL_TO_FORTRAN_ANYD(f1fab),
+                                     BL_TO_FORTRAN_ANYD(f2fab),
+                                     BL_TO_FORTRAN_ANYD(f3fab),
+                                     BL_TO_FORTRAN_ANYD(m0),
+                                     BL_TO_FORTRAN_ANYD(m1),
+                                     BL_TO_FORTRAN_ANYD(m2),
+                                     BL_TO_FORTRAN_ANYD(m3),
+                                     rc.data(), re.data(),
+                                     BL_TO_FORTRAN_BOX(vbx), dxinv, redblack);
 #endif
 
 #if (AMREX_SPACEDIM == 3)
-        amrex_mlpoisson_gsrb(BL_TO_FORTRAN_BOX(tbx),
-                             BL_TO_FORTRAN_ANYD(solnfab),
-                             BL_TO_FORTRAN_ANYD(rhsfab),
-                             BL_TO_FORTRAN_ANYD(f0fab),
-                             BL_TO_FORTRAN_ANYD(f1fab),
-                             BL_TO_FORTRAN_ANYD(f2fab),
-                             BL_TO_FORTRAN_ANYD(f3fab),
-                             BL_TO_FORTRAN_ANYD(f4fab),
-                             BL_TO_FORTRAN_ANYD(f5fab),
-                             BL_TO_FORTRAN_ANYD(m0),
-                             BL_TO_FORTRAN_ANYD(m1),
-                             BL_TO_FORTRAN_ANYD(m2),
-                             BL_TO_FORTRAN_ANYD(m3),
-                             BL_TO_FORTRAN_ANYD(m4),
-                             BL_TO_FORTRAN_ANYD(m5),
-                             BL_TO_FORTRAN_BOX(vbx), dxinv, redblack);
+                amrex_mlpoisson_gsrb(BL_TO_FORTRAN_BOX(tbx),
+                                     BL_TO_FORTRAN_N_ANYD(solnfab,n),
+                                     BL_TO_FORTRAN_N_ANYD(rhsfab,n),
+                                     BL_TO_FORTRAN_ANYD(f0fab),
+                                     BL_TO_FORTRAN_ANYD(f1fab),
+                                     BL_TO_FORTRAN_ANYD(f2fab),
+                                     BL_TO_FORTRAN_ANYD(f3fab),
+                                     BL_TO_FORTRAN_ANYD(f4fab),
+                                     BL_TO_FORTRAN_ANYD(f5fab),
+                                     BL_TO_FORTRAN_ANYD(m0),
+                                     BL_TO_FORTRAN_ANYD(m1),
+                                     BL_TO_FORTRAN_ANYD(m2),
+                                     BL_TO_FORTRAN_ANYD(m3),
+                                     BL_TO_FORTRAN_ANYD(m4),
+                                     BL_TO_FORTRAN_ANYD(m5),
+                                     BL_TO_FORTRAN_BOX(vbx), dxinv, redblack);
 #endif
+            }
+        }
     }
 }
 
@@ -252,20 +269,25 @@ MLPoisson::FFlux (int amrlev, const MFIter& mfi,
     const auto& re = mfac.cellEdges(mfi);
     const Box& vbx = m_grids[amrlev][mglev][mfi];
 #endif
-    amrex_mlpoisson_flux(BL_TO_FORTRAN_BOX(box),
-                         AMREX_D_DECL(BL_TO_FORTRAN_ANYD(*flux[0]),
-                                      BL_TO_FORTRAN_ANYD(*flux[1]),
-                                      BL_TO_FORTRAN_ANYD(*flux[2])),
-                         BL_TO_FORTRAN_ANYD(sol),
+    for (int n = 0; n < m_ncomp; ++n)
+    {
+        amrex_mlpoisson_flux(BL_TO_FORTRAN_BOX(box),
+                             AMREX_D_DECL(BL_TO_FORTRAN_N_ANYD(*flux[0],n),
+                                          BL_TO_FORTRAN_N_ANYD(*flux[1],n),
+                                          BL_TO_FORTRAN_N_ANYD(*flux[2],n)),
+                             BL_TO_FORTRAN_N_ANYD(sol,n),
 #if (AMREX_SPACEDIM != 3)
-                         rc.data(), re.data(), vbx.loVect(), vbx.hiVect(),
+                             rc.data(), re.data(), vbx.loVect(), vbx.hiVect(),
 #endif
-                         dxinv, face_only);
+                             dxinv, face_only);
+    }
 }
 
 std::unique_ptr<MLLinOp>
 MLPoisson::makeNLinOp (int grid_size) const
 {
+    AMREX_ALWAYS_ASSERT_WITH_MESSAGE(m_ncomp == 1, "MLPoisson::makeNLinOp: ncomp > 1 not supported");
+
     const Geometry& geom = m_geom[0].back();
     const BoxArray& ba = makeNGrids(grid_size);
 
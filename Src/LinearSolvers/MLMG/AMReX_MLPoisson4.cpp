@@ -0,0 +1,212 @@
+
+#include <AMReX_MLPoisson4.H>
+#include <AMReX_MLPoisson4_F.H>
+
+namespace amrex {
+
+MLPoisson4::MLPoisson4 (const Vector<Geometry>& a_geom,
+                        const Vector<BoxArray>& a_grids,
+                        const Vector<DistributionMapping>& a_dmap,
+                        const LPInfo& a_info,
+                        const Vector<FabFactory<FArrayBox> const*>& a_factory)
+{
+    define(a_geom, a_grids, a_dmap, a_info, a_factory);
+}
+
+void
+MLPoisson4::define (const Vector<Geometry>& a_geom,
+                    const Vector<BoxArray>& a_grids,
+                    const Vector<DistributionMapping>& a_dmap,
+                    const LPInfo& a_info,
+                    const Vector<FabFactory<FArrayBox> const*>& a_factory)
+{
+    BL_PROFILE("MLPoisson4::define()");
+    AMREX_ALWAYS_ASSERT_WITH_MESSAGE(a_geom[0].IsCartesian(),
+                                     "MLPoisson4 only supports Cartesian coordinates");
+    MLPoisson::define(a_geom, a_grids, a_dmap, a_info, a_factory);
+}
+
+MLPoisson4::~MLPoisson4 ()
+{}
+
+void
+MLPoisson4::prepareForSolve ()
+{
+    BL_PROFILE("MLPoisson4::prepareForSolve()");
+
+    MLPoisson::prepareForSolve();
+
+    m_diag.clear();
+    m_diag.resize(m_num_amr_levels);
+
+    const int mglev = 0;
+    for (int amrlev = 0; amrlev < m_num_amr_levels; ++amrlev)
+    {
+        const Real* dxinv = m_geom[amrlev][mglev].InvCellSize();
+        Real gamma = 0.0;
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            gamma -= (30.0/12.0)*dxinv[idim]*dxinv[idim];
+        }
+
+        MultiFab& diag = m_diag[amrlev];
+        diag.define(m_grids[amrlev][mglev], m_dmap[amrlev][mglev], 1, 0);
+        diag.setVal(gamma);
+
+        const auto& maskvals = m_maskvals[amrlev][mglev];
+        const auto& bcondloc = *m_bcondloc[amrlev][mglev];
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        for (MFIter mfi(diag); mfi.isValid(); ++mfi)
+        {
+            const Box& vbx = mfi.validbox();
+            const RealTuple & bdl = bcondloc.bndryLocs(mfi);
+            const BCTuple   & bdc = bcondloc.bndryConds(mfi);
+
+            for (OrientationIter oitr; oitr; ++oitr)
+            {
+                const Orientation ori = oitr();
+                const Mask& m = maskvals[ori][mfi];
+                amrex_mlpoisson4_diag_bc(BL_TO_FORTRAN_BOX(vbx),
+                                         BL_TO_FORTRAN_ANYD(diag[mfi]),
+                                         BL_TO_FORTRAN_ANYD(m),
+                                         ori, bdc[ori], bdl[ori], dxinv);
+            }
+        }
+    }
+}
+
+void
+MLPoisson4::applyBC (int amrlev, int mglev, MultiFab& in, BCMode bc_mode, StateMode s_mode,
+                     const MLMGBndry* bndry, bool skip_fillboundary) const
+{
+    if (mglev > 0) {
+        MLPoisson::applyBC(amrlev, mglev, in, bc_mode, s_mode, bndry, skip_fillboundary);
+        return;
+    }
+
+    BL_PROFILE("MLPoisson4::applyBC()");
+    BL_ASSERT(bndry != nullptr || bc_mode == BCMode::Homogeneous);
+    AMREX_ALWAYS_ASSERT_WITH_MESSAGE(in.nGrow() >= 2, "MLPoisson4::applyBC: need two ghost cells");
+
+    if (!skip_fillboundary) {
+        CommStatsScope css(*this, amrlev, mglev);
+        in.FillBoundary(0, 1, m_geom[amrlev][mglev].periodicity(), true);
+    }
+
+    const int flagbc = (bc_mode == BCMode::Homogeneous) ? 0 : 1;
+
+    const Real* dxinv = m_geom[amrlev][mglev].InvCellSize();
+
+    const auto& maskvals = m_maskvals[amrlev][mglev];
+    const auto& bcondloc = *m_bcondloc[amrlev][mglev];
+
+    FArrayBox foo(Box::TheUnitBox());
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(in, MFItInfo().SetDynamic(true)); mfi.isValid(); ++mfi)
+    {
+        const Box& vbx   = mfi.validbox();
+        FArrayBox& iofab = in[mfi];
+
+        const RealTuple & bdl = bcondloc.bndryLocs(mfi);
+        const BCTuple   & bdc = bcondloc.bndryConds(mfi);
+
+        for (OrientationIter oitr; oitr; ++oitr)
+        {
+            const Orientation ori = oitr();
+
+            const FArrayBox& fsfab = (bndry != nullptr) ? bndry->bndryValues(ori)[mfi] : foo;
+            const Mask& m = maskvals[ori][mfi];
+
+            amrex_mlpoisson4_apply_bc(BL_TO_FORTRAN_BOX(vbx),
+                                      BL_TO_FORTRAN_ANYD(iofab),
+                                      BL_TO_FORTRAN_ANYD(m),
+                                      ori, bdc[ori], bdl[ori],
+                                      BL_TO_FORTRAN_ANYD(fsfab),
+                                      dxinv, flagbc);
+        }
+    }
+}
+
+void
+MLPoisson4::Fapply (int amrlev, int mglev, MultiFab& out, const MultiFab& in,
+                    FRegion region) const
+{
+    if (mglev > 0) {
+        MLPoisson::Fapply(amrlev, mglev, out, in, region);
+        return;
+    }
+
+    BL_PROFILE("MLPoisson4::Fapply()");
+    AMREX_ASSERT(region == FRegion::all);
+
+    const Real* dxinv = m_geom[amrlev][mglev].InvCellSize();
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(out, true); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.tilebox();
+        amrex_mlpoisson4_adotx(BL_TO_FORTRAN_BOX(bx),
+                               BL_TO_FORTRAN_ANYD(out[mfi]),
+                               BL_TO_FORTRAN_ANYD(in[mfi]),
+                               dxinv);
+    }
+}
+
+void
+MLPoisson4::Fsmooth (int amrlev, int mglev, MultiFab& sol, const MultiFab& rhs, int redblack,
+                     FRegion region) const
+{
+    if (mglev > 0) {
+        MLPoisson::Fsmooth(amrlev, mglev, sol, rhs, redblack, region);
+        return;
+    }
+
+    BL_PROFILE("MLPoisson4::Fsmooth()");
+    AMREX_ASSERT(region == FRegion::all);
+
+    const Real* dxinv = m_geom[amrlev][mglev].InvCellSize();
+    const MultiFab& diag = m_diag[amrlev];
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(sol,MFItInfo().EnableTiling().SetDynamic(true));
+         mfi.isValid(); ++mfi)
+    {
+        const Box& tbx = mfi.tilebox();
+        amrex_mlpoisson4_gs3(BL_TO_FORTRAN_BOX(tbx),
+                             BL_TO_FORTRAN_ANYD(sol[mfi]),
+                             BL_TO_FORTRAN_ANYD(rhs[mfi]),
+                             BL_TO_FORTRAN_ANYD(diag[mfi]),
+                             dxinv, redblack);
+    }
+}
+
+void
+MLPoisson4::FFlux (int amrlev, const MFIter& mfi,
+                   const Array<FArrayBox*,AMREX_SPACEDIM>& flux,
+                   const FArrayBox& sol, Location, const int face_only) const
+{
+    BL_PROFILE("MLPoisson4::FFlux()");
+
+    const int mglev = 0;
+    const Box& box = mfi.tilebox();
+    const Real* dxinv = m_geom[amrlev][mglev].InvCellSize();
+
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
+    {
+        amrex_mlpoisson4_flux(BL_TO_FORTRAN_BOX(box),
+                              BL_TO_FORTRAN_ANYD(*flux[idim]),
+                              BL_TO_FORTRAN_ANYD(sol),
+                              dxinv, idim, face_only);
+    }
+}
+
+}
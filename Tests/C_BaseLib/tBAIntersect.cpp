@@ -0,0 +1,141 @@
+//
+// Times BoxArray::intersections and BoxArray::complementIn with the hash
+// and with the box tree, on the BoxArrays in the ba.* files and on one with
+// boxes of very different sizes.
+//
+//     tBAIntersect.ex [files="ba.15784 ba.95860"]
+//
+
+#include <iostream>
+#include <fstream>
+#include <AMReX.H>
+#include <AMReX_BoxArray.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Print.H>
+#include <AMReX_Utility.H>
+
+using namespace amrex;
+
+namespace {
+
+struct Result
+{
+    double t_isect = 0.0;
+    double t_crse  = 0.0;
+    double t_compl = 0.0;
+    long   n_isect = 0;
+    long   n_crse  = 0;
+    long   n_compl = 0;
+};
+
+Result
+run (const BoxArray& ba0, int use_box_tree)
+{
+    BARef::use_box_tree = use_box_tree;
+
+    // A new BARef, so that the hash or the tree is built again.
+    BoxArray ba(ba0.boxList());
+
+    Result r;
+    std::vector< std::pair<int,Box> > isects;
+
+    double t0 = amrex::second();
+    for (int i = 0; i < ba.size(); ++i) {
+        ba.intersections(amrex::grow(ba[i],1), isects);
+        r.n_isect += isects.size();
+    }
+    r.t_isect = amrex::second() - t0;
+
+    // A coarsened view shares the hash or the tree of ba.
+    BoxArray cba = ba;
+    cba.coarsen(2);
+    t0 = amrex::second();
+    for (int i = 0; i < cba.size(); ++i) {
+        cba.intersections(amrex::grow(cba[i],1), isects);
+        r.n_crse += isects.size();
+    }
+    r.t_crse = amrex::second() - t0;
+
+    BoxList bl;
+    t0 = amrex::second();
+    for (int i = 0; i < ba.size(); i += 7) {
+        ba.complementIn(bl, amrex::grow(ba[i],2));
+        for (const Box& b : bl) r.n_compl += b.numPts();
+    }
+    r.t_compl = amrex::second() - t0;
+
+    return r;
+}
+
+void
+compare (const std::string& name, const BoxArray& ba)
+{
+    const Result h = run(ba, 0);
+    const Result t = run(ba, 1);
+
+    amrex::Print() << name << ": " << ba.size() << " boxes\n"
+                   << "    intersections:           hash " << h.t_isect
+                   << "  tree " << t.t_isect << "\n"
+                   << "    coarsened intersections: hash " << h.t_crse
+                   << "  tree " << t.t_crse << "\n"
+                   << "    complementIn:            hash " << h.t_compl
+                   << "  tree " << t.t_compl << "\n";
+
+    if (h.n_isect != t.n_isect || h.n_crse != t.n_crse || h.n_compl != t.n_compl) {
+        amrex::Abort("tBAIntersect: the hash and the tree give different results");
+    }
+}
+
+}
+
+int
+main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+    {
+        const int use_box_tree = BARef::use_box_tree;
+
+        Vector<std::string> files {"ba.60", "ba.213", "ba.mac.294", "ba.3865", "ba.5034",
+                                   "ba.15456", "ba.15784", "ba.23925", "ba.25600", "ba.95860"};
+        ParmParse pp;
+        pp.queryarr("files", files);
+
+        for (const auto& f : files)
+        {
+            std::ifstream ifs(f.c_str(), std::ios::in);
+            if (!ifs.good()) amrex::FileOpenFailed(f);
+            BoxArray ba;
+            ba.readFrom(ifs);
+            compare(f, ba);
+        }
+
+        //
+        // Boxes of size 128 with boxes of size 8 in a shell.
+        //
+        {
+            const Box domain(IntVect(AMREX_D_DECL(0,0,0)), IntVect(AMREX_D_DECL(511,511,511)));
+            BoxList big(domain);
+            big.maxSize(128);
+            BoxList bl;
+            for (const Box& b : big)
+            {
+                Real r2 = 0.0;
+                for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                    const Real x = b.smallEnd(idim) + 64 - 256;
+                    r2 += x*x;
+                }
+                if (std::abs(std::sqrt(r2)-180.) < 120.) {
+                    BoxList small(b);
+                    small.maxSize(8);
+                    bl.join(small);
+                } else {
+                    bl.push_back(b);
+                }
+            }
+            compare("8 and 128", BoxArray(bl));
+        }
+
+        BARef::use_box_tree = use_box_tree;
+    }
+    amrex::Finalize();
+}
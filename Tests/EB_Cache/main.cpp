@@ -0,0 +1,181 @@
+//
+// Builds an EB2 IndexSpace, writes it to the cache, reads it back and
+// checks that every level read from the cache has the same data as the
+// level that was built.
+//
+//     main3d.gnu.MPI.ex inputs
+//
+
+#include <AMReX.H>
+#include <AMReX_EB2.H>
+#include <AMReX_EB2_IF.H>
+#include <AMReX_MultiFab.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Print.H>
+#include <AMReX_Utility.H>
+
+using namespace amrex;
+
+namespace {
+
+struct LevelData
+{
+    FabArray<EBCellFlagFab> cellflag;
+    MultiFab levelset;
+    MultiFab volfrac;
+    MultiFab centroid;
+    MultiFab bndryarea;
+    MultiFab bndrycent;
+    MultiFab bndrynorm;
+    Array<MultiFab,AMREX_SPACEDIM> areafrac;
+    Array<MultiFab,AMREX_SPACEDIM> facecent;
+};
+
+void
+fill (LevelData& d, const EB2::Level& eb_level, const Geometry& geom,
+      const BoxArray& ba, const DistributionMapping& dm)
+{
+    const int ng = 2;
+    d.cellflag.define(ba, dm, 1, ng);
+    d.levelset.define(amrex::convert(ba,IntVect::TheNodeVector()), dm, 1, 0);
+    d.volfrac.define(ba, dm, 1, ng);
+    d.centroid.define(ba, dm, AMREX_SPACEDIM, ng);
+    d.bndryarea.define(ba, dm, 1, ng);
+    d.bndrycent.define(ba, dm, AMREX_SPACEDIM, ng);
+    d.bndrynorm.define(ba, dm, AMREX_SPACEDIM, ng);
+    Array<MultiFab*,AMREX_SPACEDIM> areafrac, facecent;
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        const BoxArray& fba = amrex::convert(ba, IntVect::TheDimensionVector(idim));
+        d.areafrac[idim].define(fba, dm, 1, ng);
+        d.facecent[idim].define(fba, dm, AMREX_SPACEDIM-1, ng);
+        areafrac[idim] = &d.areafrac[idim];
+        facecent[idim] = &d.facecent[idim];
+    }
+
+    eb_level.fillEBCellFlag(d.cellflag, geom);
+    eb_level.fillLevelSet(d.levelset, geom);
+    eb_level.fillVolFrac(d.volfrac, geom);
+    eb_level.fillCentroid(d.centroid, geom);
+    eb_level.fillBndryArea(d.bndryarea, geom);
+    eb_level.fillBndryCent(d.bndrycent, geom);
+    eb_level.fillBndryNorm(d.bndrynorm, geom);
+    eb_level.fillAreaFrac(areafrac, geom);
+    eb_level.fillFaceCent(facecent, geom);
+}
+
+Real
+maxDiff (const MultiFab& a, const MultiFab& b)
+{
+    MultiFab diff(a.boxArray(), a.DistributionMap(), a.nComp(), a.nGrow());
+    MultiFab::Copy(diff, a, 0, 0, a.nComp(), a.nGrow());
+    MultiFab::Subtract(diff, b, 0, 0, a.nComp(), a.nGrow());
+    Real r = 0.0;
+    for (int n = 0; n < a.nComp(); ++n) {
+        r = std::max(r, diff.norm0(n, a.nGrow()));
+    }
+    return r;
+}
+
+void
+compare (int lev, const LevelData& a, const LevelData& b)
+{
+    long nflag = 0;
+    for (MFIter mfi(a.cellflag); mfi.isValid(); ++mfi)
+    {
+        const auto& afab = a.cellflag[mfi];
+        const auto& bfab = b.cellflag[mfi];
+        for (BoxIterator bi(afab.box()); bi.ok(); ++bi) {
+            if (afab(bi()) != bfab(bi())) ++nflag;
+        }
+    }
+    ParallelDescriptor::ReduceLongSum(nflag);
+
+    Real r = maxDiff(a.levelset, b.levelset);
+    r = std::max(r, maxDiff(a.volfrac, b.volfrac));
+    r = std::max(r, maxDiff(a.centroid, b.centroid));
+    r = std::max(r, maxDiff(a.bndryarea, b.bndryarea));
+    r = std::max(r, maxDiff(a.bndrycent, b.bndrycent));
+    r = std::max(r, maxDiff(a.bndrynorm, b.bndrynorm));
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        r = std::max(r, maxDiff(a.areafrac[idim], b.areafrac[idim]));
+        r = std::max(r, maxDiff(a.facecent[idim], b.facecent[idim]));
+    }
+
+    amrex::Print() << "level " << lev << ": " << nflag << " different cell flags, "
+                   << "max difference " << r << "\n";
+
+    if (nflag != 0 || r != 0.0) {
+        amrex::Abort("EB_Cache: the cached level differs from the built level");
+    }
+}
+
+}
+
+int
+main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+    {
+        int n_cell = 64;
+        int max_grid_size = 16;
+        std::string cache_dir = "eb2_cache_test";
+        {
+            ParmParse pp;
+            pp.query("n_cell", n_cell);
+            pp.query("max_grid_size", max_grid_size);
+            pp.query("cache_dir", cache_dir);
+        }
+
+        RealBox rb({AMREX_D_DECL(0.,0.,0.)}, {AMREX_D_DECL(1.,1.,1.)});
+        Array<int,AMREX_SPACEDIM> is_periodic {AMREX_D_DECL(0,1,0)};
+        Geometry geom(Box(IntVect(0),IntVect(n_cell-1)), &rb, 0, is_periodic.data());
+
+        auto gshop = EB2::makeShop(EB2::makeUnion(
+            EB2::SphereIF(0.2, {AMREX_D_DECL(0.5,0.5,0.5)}, false),
+            EB2::BoxIF({AMREX_D_DECL(0.1,0.1,0.1)}, {AMREX_D_DECL(0.3,0.35,0.4)}, false)));
+
+        const int max_coarsening_level = 3;
+        Vector<Geometry> geoms {geom};
+        for (int lev = 1; lev <= max_coarsening_level; ++lev) {
+            geoms.push_back(Geometry(amrex::coarsen(geoms.back().Domain(),2), &rb, 0,
+                                     is_periodic.data()));
+        }
+        Vector<BoxArray> grids(max_coarsening_level+1);
+        Vector<DistributionMapping> dmaps(max_coarsening_level+1);
+        for (int lev = 0; lev <= max_coarsening_level; ++lev) {
+            grids[lev].define(geoms[lev].Domain());
+            grids[lev].maxSize(max_grid_size);
+            dmaps[lev].define(grids[lev]);
+        }
+
+        // Build without the cache, write the cache, and read it back.
+        Vector<Vector<LevelData> > data(3);
+        const std::string saved_cache_dir = EB2::cache_dir;
+        for (int i = 0; i < 3; ++i)
+        {
+            EB2::cache_dir = (i == 0) ? std::string() : cache_dir;
+            if (i == 1) {
+                amrex::UtilCreateDirectoryDestructive(cache_dir);
+            }
+            EB2::Build(gshop, geom, 2, max_coarsening_level);
+
+            // The coarsest levels may not exist.
+            data[i].resize(EB2::maxCoarseningLevel(geom, max_coarsening_level)+1);
+            for (int lev = 0; lev < data[i].size(); ++lev)
+            {
+                const EB2::Level& eb_level = EB2::IndexSpace::top().getLevel(geoms[lev]);
+                fill(data[i][lev], eb_level, geoms[lev], grids[lev], dmaps[lev]);
+            }
+            EB2::IndexSpace::pop();
+        }
+        EB2::cache_dir = saved_cache_dir;
+
+        if (data[2].size() != data[0].size()) {
+            amrex::Abort("EB_Cache: the cache has a different number of levels");
+        }
+        for (int lev = 0; lev < data[0].size(); ++lev) {
+            compare(lev, data[0][lev], data[2][lev]);
+        }
+    }
+    amrex::Finalize();
+}
@@ -0,0 +1,248 @@
+//
+// Times the interpolaters on one fab, and compares the kernels specialized
+// for refinement ratio 2 and 4 with the same kernels for a runtime ratio.
+//
+//     main.exe inputs [n_cell=32] [ncomp=4] [ratio=2] [nrep=20]
+//
+// n_cell is the number of fine cells of the box in each direction.  With
+// ratio 2, CellConservativeQuartic (Fortran) is timed too.
+//
+
+#include <AMReX.H>
+#include <AMReX_Print.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Utility.H>
+#include <AMReX_Geometry.H>
+#include <AMReX_FArrayBox.H>
+#include <AMReX_Interpolater.H>
+#include <AMReX_Interp_C.H>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace amrex;
+
+namespace {
+
+void fill (FArrayBox& fab, const Geometry& geom)
+{
+    const Box& bx = fab.box();
+    const Real* dx = geom.CellSize();
+    const Real* problo = geom.ProbLo();
+    for (int n = 0; n < fab.nComp(); ++n) {
+        for (BoxIterator bit(bx); bit.ok(); ++bit) {
+            const IntVect& iv = bit();
+            Real v = 1.0 + 0.1*n;
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                const Real x = problo[idim] + (iv[idim]+0.5)*dx[idim];
+                v += std::sin(3.0*(idim+1)*x + n) + 0.01*amrex::Random();
+            }
+            fab(iv,n) = v;
+        }
+    }
+}
+
+Real maxdiff (const FArrayBox& a, const FArrayBox& b, const Box& bx, int ncomp)
+{
+    FArrayBox d(bx, ncomp);
+    d.copy(a, bx, 0, bx, 0, ncomp);
+    d.minus(b, bx, 0, 0, ncomp);
+    return d.norm(bx, 0, 0, ncomp);
+}
+
+void report (const std::string& name, double t, int nrep, long npts)
+{
+    amrex::Print() << "  " << name << ": " << t/nrep << " seconds per call, "
+                   << (t > 0.0 ? double(npts)*nrep/t : 0.0) << " fine cells per second\n";
+}
+
+// The kernels that work on fine cells
+template <class RT>
+void run_kernels (const Box& fbx, FArrayBox& pfine, FArrayBox& fine, int ncomp,
+                  const FArrayBox& crse,
+                  const FArrayBox& ccfab, const FArrayBox& alpha, FArrayBox& ccfab_mm,
+                  const Vector<Real>& voff, const Box& nfbx, FArrayBox& nfine,
+                  const FArrayBox& ncrse, const FArrayBox& nslope, RT const& ratio, int nrep,
+                  Vector<double>& t)
+{
+    t.assign(4, 0.0);
+
+    double t0 = amrex::second();
+    for (int irep = 0; irep < nrep; ++irep) {
+        amrex::pcinterp_interp(fbx, pfine, 0, ncomp, crse, 0, ratio);
+    }
+    t[0] = amrex::second() - t0;
+
+    t0 = amrex::second();
+    for (int irep = 0; irep < nrep; ++irep) {
+        amrex::cellconslin_interp(fbx, fine, 0, ncomp, ccfab, crse, 0, voff.data(), ratio);
+    }
+    t[1] = amrex::second() - t0;
+
+    t0 = amrex::second();
+    for (int irep = 0; irep < nrep; ++irep) {
+        amrex::cellconslin_slopes_mmlim(ccfab_mm.box(), ccfab_mm, alpha, ncomp, ratio);
+    }
+    t[2] = amrex::second() - t0;
+
+    t0 = amrex::second();
+    for (int irep = 0; irep < nrep; ++irep) {
+        amrex::nodebilin_interp(nfbx, nfine, 0, ncomp, nslope, ncrse, 0, ratio);
+    }
+    t[3] = amrex::second() - t0;
+}
+
+}
+
+int main (int argc, char* argv[])
+{
+    amrex::Initialize(argc,argv);
+    {
+        int n_cell = 32;
+        int ncomp = 4;
+        int iratio = 2;
+        int nrep = 20;
+        {
+            ParmParse pp;
+            pp.query("n_cell", n_cell);
+            pp.query("ncomp", ncomp);
+            pp.query("ratio", iratio);
+            pp.query("nrep", nrep);
+        }
+
+        const IntVect ratio(iratio);
+        AMREX_ALWAYS_ASSERT(n_cell % iratio == 0);
+
+        const Box fdomain(IntVect(0), IntVect(4*n_cell-1));
+        const Box cdomain = amrex::coarsen(fdomain, ratio);
+        RealBox rb({AMREX_D_DECL(0.,0.,0.)}, {AMREX_D_DECL(1.,1.,1.)});
+        Array<int,AMREX_SPACEDIM> is_periodic{AMREX_D_DECL(0,0,0)};
+        Geometry fgeom(fdomain, &rb, 0, is_periodic.data());
+        Geometry cgeom(cdomain, &rb, 0, is_periodic.data());
+
+        // A fine box away from the domain boundary
+        const Box fbx(IntVect(n_cell), IntVect(2*n_cell-1));
+        const long npts = fbx.numPts();
+
+        Vector<BCRec> bcr(ncomp);
+        for (int n = 0; n < ncomp; ++n) {
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                bcr[n].setLo(idim, BCType::int_dir);
+                bcr[n].setHi(idim, BCType::int_dir);
+            }
+        }
+
+        amrex::Print() << "Fine box: " << fbx << ", ncomp = " << ncomp
+                       << ", ratio = " << iratio << ", nrep = " << nrep << "\n\n";
+
+        //
+        // Interpolaters through the virtual interface
+        //
+        struct Entry { Interpolater* mapper; std::string name; };
+        Vector<Entry> mappers{{&pc_interp, "PCInterp"},
+                              {&cell_cons_interp, "CellConservativeLinear (mc limiter)"},
+                              {&lincc_interp, "CellConservativeLinear (linear limiter)"},
+                              {&protected_interp, "CellConservativeProtected"}};
+        if (iratio == 2) {
+            mappers.push_back({&quartic_interp, "CellConservativeQuartic (Fortran)"});
+        }
+
+        amrex::Print() << "Interpolater::interp\n";
+        for (const auto& m : mappers)
+        {
+            FArrayBox crse(m.mapper->CoarseBox(fbx, ratio), ncomp);
+            fill(crse, cgeom);
+            FArrayBox fine(fbx, ncomp);
+
+            m.mapper->interp(crse, 0, fine, 0, ncomp, fbx, ratio, cgeom, fgeom, bcr, 0, 0);
+            double t0 = amrex::second();
+            for (int irep = 0; irep < nrep; ++irep) {
+                m.mapper->interp(crse, 0, fine, 0, ncomp, fbx, ratio, cgeom, fgeom, bcr, 0, 0);
+            }
+            report(m.name, amrex::second()-t0, nrep, npts);
+        }
+
+        {
+            const Box nfbx = amrex::surroundingNodes(fbx);
+            FArrayBox crse(node_bilinear_interp.CoarseBox(nfbx, ratio), ncomp);
+            fill(crse, cgeom);
+            FArrayBox fine(nfbx, ncomp);
+            node_bilinear_interp.interp(crse, 0, fine, 0, ncomp, nfbx, ratio,
+                                        cgeom, fgeom, bcr, 0, 0);
+            double t0 = amrex::second();
+            for (int irep = 0; irep < nrep; ++irep) {
+                node_bilinear_interp.interp(crse, 0, fine, 0, ncomp, nfbx, ratio,
+                                            cgeom, fgeom, bcr, 0, 0);
+            }
+            report("NodeBilinear", amrex::second()-t0, nrep, nfbx.numPts());
+        }
+
+        if (iratio != 2 && iratio != 4) {
+            amrex::Print() << "\nNo specialized kernels for ratio " << iratio << "\n";
+        }
+        else
+        {
+            //
+            // The kernels that work on fine cells, for the ratio as an
+            // IntVect and as a StaticRatio
+            //
+            const Box cbx = amrex::coarsen(fbx, ratio);
+            FArrayBox crse(amrex::grow(cbx,1), ncomp);
+            fill(crse, cgeom);
+
+            FArrayBox ccfab(cbx, ncomp*(AMREX_SPACEDIM+2));
+            fill(ccfab, cgeom);
+            ccfab.mult(0.01);
+            const Vector<Real> voff = amrex::ccinterp_compute_voff(cbx, ratio, cgeom, fgeom);
+
+            FArrayBox alpha(fbx, ncomp);
+            fill(alpha, fgeom);
+            alpha.mult(0.01);
+            alpha.plus(0.95);
+            FArrayBox ccfab_mm_g(cbx, ncomp*(AMREX_SPACEDIM+2));
+            FArrayBox ccfab_mm_s(cbx, ncomp*(AMREX_SPACEDIM+2));
+
+            const Box nfbx = amrex::surroundingNodes(fbx);
+            const Box ncbx = node_bilinear_interp.CoarseBox(nfbx, ratio);
+            FArrayBox ncrse(ncbx, ncomp);
+            fill(ncrse, cgeom);
+            const Box nsbx = amrex::enclosedCells(ncbx);
+            FArrayBox nslope(nsbx, ncomp*(AMREX_D_TERM(2,*2,*2)-1));
+            amrex::nodebilin_slopes(nsbx, nslope, ncrse, 0, ncomp, ratio);
+
+            FArrayBox pfine_g(fbx, ncomp), pfine_s(fbx, ncomp);
+            FArrayBox fine_g(fbx, ncomp), fine_s(fbx, ncomp);
+            FArrayBox nfine_g(nfbx, ncomp), nfine_s(nfbx, ncomp);
+
+            Vector<double> tg, ts;
+            ccfab_mm_g.copy(ccfab);
+            run_kernels(fbx, pfine_g, fine_g, ncomp, crse, ccfab, alpha, ccfab_mm_g, voff,
+                        nfbx, nfine_g, ncrse, nslope, ratio, nrep, tg);
+            ccfab_mm_s.copy(ccfab);
+            if (iratio == 2) {
+                run_kernels(fbx, pfine_s, fine_s, ncomp, crse, ccfab, alpha, ccfab_mm_s, voff,
+                            nfbx, nfine_s, ncrse, nslope, StaticRatio<2>(), nrep, ts);
+            } else {
+                run_kernels(fbx, pfine_s, fine_s, ncomp, crse, ccfab, alpha, ccfab_mm_s, voff,
+                            nfbx, nfine_s, ncrse, nslope, StaticRatio<4>(), nrep, ts);
+            }
+
+            const Vector<std::string> names{"pcinterp_interp", "cellconslin_interp",
+                                            "cellconslin_slopes_mmlim", "nodebilin_interp"};
+            amrex::Print() << "\nKernels: IntVect ratio / StaticRatio<" << iratio << ">\n";
+            for (int i = 0; i < 4; ++i) {
+                amrex::Print() << "  " << names[i] << ": " << tg[i]/nrep << " / " << ts[i]/nrep
+                               << " seconds per call, speedup "
+                               << (ts[i] > 0.0 ? tg[i]/ts[i] : 0.0) << "\n";
+            }
+
+            Real d = maxdiff(pfine_g, pfine_s, fbx, ncomp);
+            d = std::max(d, maxdiff(fine_g, fine_s, fbx, ncomp));
+            d = std::max(d, maxdiff(nfine_g, nfine_s, nfbx, ncomp));
+            d = std::max(d, maxdiff(ccfab_mm_g, ccfab_mm_s, cbx, ccfab.nComp()));
+            amrex::Print() << "\nMax difference between the kernels: " << d << "\n";
+            AMREX_ALWAYS_ASSERT(d == 0.0);
+        }
+    }
+    amrex::Finalize();
+}
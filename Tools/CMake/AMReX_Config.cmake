@@ -124,6 +124,12 @@ function (configure_amrex)
       # Cray compiler has OMP turned on by default
       target_compile_options ( amrex PUBLIC $<$<CXX_COMPILER_ID:Cray>:-h;noomp> $<$<C_COMPILER_ID:Cray>:-h;noomp> )
    endif()
+
+   #
+   # Setup threads (for the helper thread of asynchronous regridding)
+   #
+   find_package (Threads REQUIRED)
+   target_link_libraries ( amrex PUBLIC ${CMAKE_THREAD_LIBS_INIT} )
       
    #
    # Add third party libraries